@@ -31,8 +31,10 @@
 #include <MC/Actor.hpp>
 #include <MC/ActorUniqueID.hpp>
 #include <MC/Level.hpp>
+#include <limits>
 #include <memory>
 #include <random>
+#include <string>
 #include <third-party/Base64/Base64.hpp>
 #include <third-party/Nlohmann/json.hpp>
 
@@ -78,6 +80,44 @@ bool ActorEx::IsPlayer() const { return false; }
 void ActorEx::SetATKByNativeDamage(double native_damage) {
   this->stats_.ATK_base = static_cast<int>(
       native_damage * world::GetEnemyATKMultiplier(this->GetLevel()) * 18.);
+
+  this->is_data_modified_ = true;
+}
+
+bool ActorEx::CheckDataRecords() {
+  // The integers must be stored in little-endian order
+  std::string record;
+  ActorEx::WriteRecordInt(record, 0x12345678);
+  if (record != "\x78\x56\x34\x12") {
+    return false;
+  }
+
+  // The 5-byte records are encoded with one "=" character, which is stripped
+  for (int level : {0, 1, 90, -1, std::numeric_limits<int>::min(),
+                    std::numeric_limits<int>::max()}) {
+    auto payload = ActorEx::EncodeData(level);
+    if (payload.find('=') != std::string::npos) {
+      return false;
+    }
+
+    int decoded_level = 0;
+    bool is_legacy = true;
+    if (!ActorEx::DecodeData(payload, &decoded_level, &is_legacy) ||
+        decoded_level != level || is_legacy) {
+      return false;
+    }
+  }
+
+  // The legacy JSON data without a version
+  int level = 0;
+  bool is_legacy = false;
+  if (!ActorEx::DecodeData(Base64::Encode(R"({"level":42})"), &level,
+                           &is_legacy) ||
+      level != 42 || !is_legacy) {
+    return false;
+  }
+
+  return true;
 }
 
 std::shared_ptr<ActorEx> ActorEx::Get(long long unique_id) {
@@ -103,6 +143,24 @@ std::shared_ptr<ActorEx> ActorEx::Make(Actor* actor) {
   return actorex;
 }
 
+int ActorEx::ReadRecordInt(const std::string& record, int offset) {
+  // The integers are stored in little-endian order
+  unsigned int value = 0;
+  for (int i = 3; i >= 0; --i) {
+    value = (value << 8) | static_cast<unsigned char>(record.at(offset + i));
+  }
+  return static_cast<int>(value);
+}
+
+void ActorEx::WriteRecordInt(std::string& record, int value) {
+  // The integers are stored in little-endian order
+  auto unsigned_value = static_cast<unsigned int>(value);
+  for (int i = 0; i < 4; ++i) {
+    record.push_back(static_cast<char>(unsigned_value & 0xFF));
+    unsigned_value >>= 8;
+  }
+}
+
 void ActorEx::LoadData() {
   static std::default_random_engine random_engine;
 
@@ -112,56 +170,49 @@ void ActorEx::LoadData() {
     throw ExceptionActorNotFound();
   }
 
-  nlohmann::json data;  // the actor data
+  bool is_data_found = false;
 
   // Attempt to get the data from tags of the Actor object
   for (const auto& tag : actor->getAllTags()) {
     if (tag.substr(0, 12) == "genshicraft_") {
-      try {
-        data = nlohmann::json::parse(Base64::Decode(tag.substr(12)));
-
-      } catch (const nlohmann::json::parse_error&) {
-        actor->removeTag(tag);  // remove the malformed tag
+      if (is_data_found || !this->ReadData(tag.substr(12))) {
+        actor->removeTag(tag);  // remove the redundant or malformed tag
         continue;
       }
 
-      actor->removeTag(
-          tag);  // the tag will be written back at the end of this method
-      break;
-    }
-  }
-
-  // Remove all GenshiCraft data tags
-  for (const auto& tag : actor->getAllTags()) {
-    if (tag.substr(0, 12) == "genshicraft_") {
-      actor->removeTag(tag);
+      is_data_found = true;
     }
   }
 
-  // Migrate the data and check its validity
-  data = ActorEx::MigrateData(data);
-
-  // Initialize the actor with template data if the actor is not initialized or
-  // the data is invalid
-  if (data.empty()) {
+  // Initialize the actor if the actor is not initialized or the data is
+  // invalid
+  if (!is_data_found) {
     std::uniform_int_distribution dist(-10, 1);
 
-    data["version"] = ActorEx::kActorExDataFormatVersion;
-
-    data["level"] =
+    this->level_ =
         world::GetWorldLevel(actor->getPosition(), actor->getDimension()) * 11 +
         dist(random_engine);
 
-    // Write the data to a tag of the Actor object
-    auto tag = Base64::Encode(nlohmann::to_string(data));
-    tag = tag.substr(
-        0, tag.find(
-               '='));  // remove the "=" characters which are forbidden in tags
-    actor->addTag("genshicraft_" + tag);
+    this->is_data_modified_ = true;
   }
 
-  // Load the data
-  this->level_ = data["level"];
+  // Write the new or migrated data back to the tags
+  if (this->is_data_modified_) {
+    this->WriteData();
+  }
+}
+
+bool ActorEx::ReadData(const std::string& payload) {
+  bool is_legacy = false;
+  if (!ActorEx::DecodeData(payload, &this->level_, &is_legacy)) {
+    return false;
+  }
+
+  if (is_legacy) {
+    this->is_data_modified_ = true;  // rewrite in the binary format
+  }
+
+  return true;
 }
 
 void ActorEx::SaveData() {
@@ -171,6 +222,15 @@ void ActorEx::SaveData() {
 
   this->is_data_saved_ = true;
 
+  // Nothing to do if the tags are up to date
+  if (!this->is_data_modified_) {
+    return;
+  }
+
+  this->WriteData();
+}
+
+void ActorEx::WriteData() {
   auto actor = this->GetActor();
 
   // Nothing to do if the mob no longer exists
@@ -185,17 +245,55 @@ void ActorEx::SaveData() {
     }
   }
 
-  nlohmann::json data;
-  data["version"] = MobEx::kActorExDataFormatVersion;
-  data["level"] = this->level_;  // the data value should be the most original
-                                 // value so do not use this->GetLevel()
+  // Write the data to a tag of the Actor object. The data value should be the
+  // most original value so do not use this->GetLevel().
+  actor->addTag("genshicraft_" + ActorEx::EncodeData(this->level_));
+
+  this->is_data_modified_ = false;
+}
+
+bool ActorEx::DecodeData(const std::string& payload, int* level,
+                         bool* is_legacy) {
+  auto record = Base64::Decode(payload);
+
+  // Read the legacy JSON data
+  if (!record.empty() && record.front() == '{') {
+    nlohmann::json data;
+    try {
+      data = nlohmann::json::parse(record);
+    } catch (const nlohmann::json::parse_error&) {
+      return false;
+    }
+
+    data = ActorEx::MigrateData(data);
+    if (data.empty()) {
+      return false;
+    }
+
+    *level = data["level"].get<int>();
+
+    *is_legacy = true;
+    return true;
+  }
+
+  if (record.size() != ActorEx::kActorExRecordSize ||
+      record.front() != ActorEx::kActorExDataFormatVersion) {
+    return false;
+  }
+
+  *level = ActorEx::ReadRecordInt(record, 1);
+
+  *is_legacy = false;
+  return true;
+}
+
+std::string ActorEx::EncodeData(int level) {
+  std::string record(1, static_cast<char>(ActorEx::kActorExDataFormatVersion));
+  ActorEx::WriteRecordInt(record, level);
 
-  // Write the data to a tag of the Mob object
-  auto tag = Base64::Encode(nlohmann::to_string(data));
-  tag = tag.substr(
-      0,
-      tag.find('='));  // remove the "=" characters which are forbidden in tags
-  actor->addTag("genshicraft_" + tag);
+  // Remove the "=" characters which are forbidden in tags
+  auto payload = Base64::Encode(record);
+  return payload.substr(0, payload.find('='));
 }
 
 nlohmann::json ActorEx::MigrateData(const nlohmann::json& old_data) {
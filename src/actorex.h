@@ -31,6 +31,7 @@
 
 #include <MC/Actor.hpp>
 #include <memory>
+#include <string>
 #include <third-party/Nlohmann/json.hpp>
 
 #include "damage.h"
@@ -119,6 +120,16 @@ class ActorEx {
    */
   virtual void SetATKByNativeDamage(double native_damage);
 
+  /**
+   * @brief Check that the data records survive a round trip through the tag
+   * payload, and that the legacy JSON data is still accepted
+   *
+   * @return True if the check passed
+   *
+   * @note This method does not touch the Level, so it can be called at load.
+   */
+  static bool CheckDataRecords();
+
   /**
    * @brief Get an ActorEx object by a unique ID
    *
@@ -140,6 +151,25 @@ class ActorEx {
   static std::shared_ptr<ActorEx> Make(Actor* actor);
 
  protected:
+  /**
+   * @brief Read a 32-bit integer from a binary data record
+   *
+   * @param record The record
+   * @param offset The offset of the integer in bytes
+   * @return The integer
+   */
+  static int ReadRecordInt(const std::string& record, int offset);
+
+  /**
+   * @brief Append a 32-bit integer to a binary data record
+   *
+   * @param record The record
+   * @param value The integer
+   */
+  static void WriteRecordInt(std::string& record, int value);
+
+  bool is_data_modified_ =
+      false;  // this flag is set when the data differs from the stored data
   bool is_data_saved_ =
       false;  // this flag is used to prevent duplicated data save.
 
@@ -148,7 +178,10 @@ class ActorEx {
   long long unique_id_;  // the unique ID
 
  private:
-  inline static const int kActorExDataFormatVersion = 1;
+  inline static const int kActorExDataFormatVersion = 2;
+  inline static const int kActorExRecordSize =
+      5;  // the size of the binary data record: the version (1 byte) and the
+          // level (4 bytes)
 
   /**
    * @brief Load the data
@@ -157,6 +190,16 @@ class ActorEx {
    */
   virtual void LoadData();
 
+  /**
+   * @brief Read the data from the payload of a data tag
+   *
+   * @param payload The tag without the "genshicraft_" prefix
+   * @return True if the data is valid
+   *
+   * @note Both the binary records and the legacy JSON data are accepted.
+   */
+  bool ReadData(const std::string& payload);
+
   /**
    * @brief Save the data
    *
@@ -165,11 +208,35 @@ class ActorEx {
   virtual void SaveData();
 
   /**
-   * @brief Migrate the data with previous data format version to current
-   * version.
+   * @brief Write the data to the tags of the Actor object
+   *
+   */
+  void WriteData();
+
+  /**
+   * @brief Decode the payload of a data tag
+   *
+   * @param payload The tag without the "genshicraft_" prefix
+   * @param level The level decoded
+   * @param is_legacy Set to true if the payload is legacy JSON data
+   * @return True if the data is valid
+   */
+  static bool DecodeData(const std::string& payload, int* level,
+                         bool* is_legacy);
+
+  /**
+   * @brief Encode the data to the payload of a data tag
+   *
+   * @param level The level
+   * @return The tag without the "genshicraft_" prefix
+   */
+  static std::string EncodeData(int level);
+
+  /**
+   * @brief Migrate the legacy JSON data to the last JSON data format version
    *
    * @param old_data The data to migrate
-   * @return The data with current data format version
+   * @return The data with JSON data format version 1
    *
    * @note If the data is invalid, this method will return an empty JSON object.
    */
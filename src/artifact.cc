@@ -38,35 +38,497 @@
 #include <MC/ListTag.hpp>
 #include <MC/Player.hpp>
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iomanip>
-#include <map>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "character.h"
 #include "exceptions.h"
+#include "item.h"
+#include "level_table.h"
 #include "playerex.h"
 #include "plugin.h"
 #include "stats.h"
+#include "world.h"
 
 namespace genshicraft {
 
+namespace {
+
+constexpr std::uint32_t kMaxPerfectHashSeed =
+    65536;  // the seeds to try when searching a perfect hash
+constexpr std::uint32_t kNoPerfectHashSeed =
+    0xFFFFFFFF;  // the seed meaning that no perfect hash is found
+
+/**
+ * @brief Hash an identifier by seeded FNV-1a
+ *
+ * @param identifier The identifier
+ * @param seed The seed
+ * @return The hash
+ */
+constexpr std::uint32_t HashIdentifier(std::string_view identifier,
+                                       std::uint32_t seed) {
+  std::uint32_t hash = 2166136261u ^ seed;
+  for (auto c : identifier) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 16777619u;
+  }
+
+  // Fold the high bits in, since FNV-1a mixes the low bits poorly
+  return hash ^ (hash >> 16);
+}
+
+/**
+ * @brief Find a seed with which the artifact identifiers are hashed to
+ * distinct slots
+ *
+ * @param info_list The artifact information
+ * @param table_size The number of slots
+ * @return The seed, or kNoPerfectHashSeed if not found
+ */
+template <int kCount>
+constexpr std::uint32_t FindPerfectHashSeed(
+    const Artifact::ArtifactInfo (&info_list)[kCount], int table_size) {
+  for (std::uint32_t seed = 0; seed < kMaxPerfectHashSeed; ++seed) {
+    bool is_perfect = true;
+    for (int i = 0; i < kCount && is_perfect; ++i) {
+      for (int j = 0; j < i && is_perfect; ++j) {
+        is_perfect = (HashIdentifier(info_list[i].identifier, seed) %
+                          table_size !=
+                      HashIdentifier(info_list[j].identifier, seed) %
+                          table_size);
+      }
+    }
+
+    if (is_perfect) {
+      return seed;
+    }
+  }
+
+  return kNoPerfectHashSeed;
+}
+
+/**
+ * @brief Build the table from the hash slots to the artifact IDs
+ *
+ * @param info_list The artifact information
+ * @param seed The seed of a perfect hash
+ * @return The table, where empty slots are -1
+ */
+template <int kTableSize, int kCount>
+constexpr std::array<int, kTableSize> BuildPerfectHashTable(
+    const Artifact::ArtifactInfo (&info_list)[kCount], std::uint32_t seed) {
+  std::array<int, kTableSize> table = {};
+  for (int i = 0; i < kTableSize; ++i) {
+    table[i] = -1;
+  }
+
+  for (int i = 0; i < kCount; ++i) {
+    table[HashIdentifier(info_list[i].identifier, seed) % kTableSize] = i;
+  }
+
+  return table;
+}
+
+constexpr int kArtifactCount = 5;  // the number of artifacts
+constexpr int kArtifactIDTableSize =
+    8;  // the number of slots of the perfect hash table
+
+// The artifact IDs are the indices
+constexpr Artifact::ArtifactInfo kArtifactInfoList[kArtifactCount] = {
+    {"genshicraft:adventurer_s_flower", "Adventurer's Flower", 0,
+     Artifact::Type::kFlowerOfLife},
+    {"genshicraft:adventurer_s_tail_feather", "Adventurer's Tail Feather", 0,
+     Artifact::Type::kPlumeOfDeath},
+    {"genshicraft:adventurer_s_pocket_watch", "Adventurer's Pocket Watch", 0,
+     Artifact::Type::kSandsOfEon},
+    {"genshicraft:adventurer_s_golden_goblet", "Adventurer's Golden Goblet", 0,
+     Artifact::Type::kGobletOfEonothem},
+    {"genshicraft:adventurer_s_bandana", "Adventurer's Bandana", 0,
+     Artifact::Type::kCircletOfLogos},
+};
+
+constexpr std::uint32_t kArtifactHashSeed = FindPerfectHashSeed(
+    kArtifactInfoList,
+    kArtifactIDTableSize);  // the seed of the perfect hash of the identifiers
+
+constexpr std::array<int, kArtifactIDTableSize> kArtifactIDTable =
+    BuildPerfectHashTable<kArtifactIDTableSize>(
+        kArtifactInfoList,
+        kArtifactHashSeed);  // the artifact IDs indexed by the hash slots
+
+constexpr int kStatTypeCount =
+    static_cast<int>(Artifact::StatType::kPhysicalDMG) +
+    1;  // the number of stat types
+
+// [A][B] means the main stat of level 0 for stat B of A-Star artifacts.
+constexpr double kMainStatBaseList[6][kStatTypeCount] = {
+    {},
+
+    {
+        129,   // kHP
+        3.1,   // kHPPercent
+        8,     // kATK
+        3.1,   // kATKPercent
+        0,     // kDEF
+        3.9,   // kDEFPercent
+        12.6,  // kElementalMastery
+        2.1,   // kCritRate
+        4.2,   // kCritDMG
+        2.4,   // kHealingBonus
+        3.5,   // kEnergyRecharge
+        3.1,   // kPyroDMG
+        3.1,   // kHydroDMG
+        3.1,   // kDendroDMG
+        3.1,   // kElectroDMG
+        3.1,   // kAnemoDMG
+        3.1,   // kCryoDMG
+        3.1,   // kGeoDMG
+        3.9,   // kPhysicalDMG
+    },
+
+    {
+        258,   // kHP
+        4.2,   // kHPPercent
+        17,    // kATK
+        4.2,   // kATKPercent
+        0,     // kDEF
+        5.2,   // kDEFPercent
+        16.8,  // kElementalMastery
+        2.8,   // kCritRate
+        5.6,   // kCritDMG
+        3.2,   // kHealingBonus
+        4.7,   // kEnergyRecharge
+        4.2,   // kPyroDMG
+        4.2,   // kHydroDMG
+        4.2,   // kDendroDMG
+        4.2,   // kElectroDMG
+        4.2,   // kAnemoDMG
+        4.2,   // kCryoDMG
+        4.2,   // kGeoDMG
+        5.2,   // kPhysicalDMG
+    },
+
+    {
+        430,  // kHP
+        5.2,  // kHPPercent
+        28,   // kATK
+        5.2,  // kATKPercent
+        0,    // kDEF
+        6.6,  // kDEFPercent
+        21.,  // kElementalMastery
+        3.5,  // kCritRate
+        7.,   // kCritDMG
+        4.,   // kHealingBonus
+        5.8,  // kEnergyRecharge
+        5.2,  // kPyroDMG
+        5.2,  // kHydroDMG
+        5.2,  // kDendroDMG
+        5.2,  // kElectroDMG
+        5.2,  // kAnemoDMG
+        5.2,  // kCryoDMG
+        5.2,  // kGeoDMG
+        6.6,  // kPhysicalDMG
+    },
+
+    {
+        645,   // kHP
+        6.3,   // kHPPercent
+        42,    // kATK
+        6.3,   // kATKPercent
+        0,     // kDEF
+        7.9,   // kDEFPercent
+        25.2,  // kElementalMastery
+        4.2,   // kCritRate
+        8.4,   // kCritDMG
+        4.8,   // kHealingBonus
+        7.,    // kEnergyRecharge
+        6.3,   // kPyroDMG
+        6.3,   // kHydroDMG
+        6.3,   // kDendroDMG
+        6.3,   // kElectroDMG
+        6.3,   // kAnemoDMG
+        6.3,   // kCryoDMG
+        6.3,   // kGeoDMG
+        7.9,   // kPhysicalDMG
+    },
+
+    {
+        717,  // kHP
+        7.0,  // kHPPercent
+        47,   // kATK
+        7.0,  // kATKPercent
+        0,    // kDEF
+        8.7,  // kDEFPercent
+        28.,  // kElementalMastery
+        4.7,  // kCritRate
+        9.3,  // kCritDMG
+        5.4,  // kHealingBonus
+        7.8,  // kEnergyRecharge
+        7.0,  // kPyroDMG
+        7.0,  // kHydroDMG
+        7.0,  // kDendroDMG
+        7.0,  // kElectroDMG
+        7.0,  // kAnemoDMG
+        7.0,  // kCryoDMG
+        7.0,  // kGeoDMG
+        8.7,  // kPhysicalDMG
+    },
+};
+
+// [A][B] means the main stat difference for stat B of A-Star artifacts.
+constexpr double kMainStatDiffList[6][kStatTypeCount] = {
+    {},
+
+    {
+        48.75,  // kHP
+        1.2,    // kHPPercent
+        3.25,   // kATK
+        1.2,    // kATKPercent
+        0,      // kDEF
+        1.5,    // kDEFPercent
+        4.75,   // kElementalMastery
+        0.8,    // kCritRate
+        1.575,  // kCritDMG
+        0.925,  // kHealingBonus
+        1.325,  // kEnergyRecharge
+        1.2,    // kPyroDMG
+        1.2,    // kHydroDMG
+        1.2,    // kDendroDMG
+        1.2,    // kElectroDMG
+        1.2,    // kAnemoDMG
+        1.2,    // kCryoDMG
+        1.2,    // kGeoDMG
+        1.5,    // kPhysicalDMG
+    },
+
+    {
+        73.25,  // kHP
+        1.2,    // kHPPercent
+        4.75,   // kATK
+        1.2,    // kATKPercent
+        0,      // kDEF
+        1.5,    // kDEFPercent
+        4.75,   // kElementalMastery
+        0.8,    // kCritRate
+        1.575,  // kCritDMG
+        0.925,  // kHealingBonus
+        1.3,    // kEnergyRecharge
+        1.2,    // kPyroDMG
+        1.2,    // kHydroDMG
+        1.2,    // kDendroDMG
+        1.2,    // kElectroDMG
+        1.2,    // kAnemoDMG
+        1.2,    // kCryoDMG
+        1.2,    // kGeoDMG
+        1.5,    // kPhysicalDMG
+    },
+
+    {
+        121.917,  // kHP
+        1.492,    // kHPPercent
+        7.917,    // kATK
+        1.492,    // kATKPercent
+        0,        // kDEF
+        1.850,    // kDEFPercent
+        5.942,    // kElementalMastery
+        0.992,    // kCritRate
+        1.983,    // kCritDMG
+        1.15,     // kHealingBonus
+        1.65,     // kEnergyRecharge
+        1.492,    // kPyroDMG
+        1.492,    // kHydroDMG
+        1.492,    // kDendroDMG
+        1.492,    // kElectroDMG
+        1.492,    // kAnemoDMG
+        1.492,    // kCryoDMG
+        1.492,    // kGeoDMG
+        1.850,    // kPhysicalDMG
+    },
+
+    {
+        182.875,  // kHP
+        1.781,    // kHPPercent
+        11.875,   // kATK
+        1.781,    // kATKPercent
+        0,        // kDEF
+        2.225,    // kDEFPercent
+        7.131,    // kElementalMastery
+        1.188,    // kCritRate
+        2.375,    // kCritDMG
+        1.375,    // kHealingBonus
+        1.981,    // kEnergyRecharge
+        1.781,    // kPyroDMG
+        1.781,    // kHydroDMG
+        1.781,    // kDendroDMG
+        1.781,    // kElectroDMG
+        1.781,    // kAnemoDMG
+        1.781,    // kCryoDMG
+        1.781,    // kGeoDMG
+        2.225,    // kPhysicalDMG
+    },
+
+    {
+        203.15,  // kHP
+        1.98,    // kHPPercent
+        13.2,    // kATK
+        1.98,    // kATKPercent
+        0,       // kDEF
+        2.48,    // kDEFPercent
+        7.925,   // kElementalMastery
+        1.32,    // kCritRate
+        2.645,   // kCritDMG
+        1.525,   // kHealingBonus
+        2.2,     // kEnergyRecharge
+        1.98,    // kPyroDMG
+        1.98,    // kHydroDMG
+        1.98,    // kDendroDMG
+        1.98,    // kElectroDMG
+        1.98,    // kAnemoDMG
+        1.98,    // kCryoDMG
+        1.98,    // kGeoDMG
+        2.48,    // kPhysicalDMG
+    },
+};
+
+// [A][B] means the possible B-stat unit substat differences of A-Star
+// artifacts.
+constexpr double kSubStatDiffList[6][kStatTypeCount][4] = {
+    {},
+
+    {
+        {23.90, 29.88},  // kHP
+        {1.17, 1.46},    // kHPPercent
+        {1.56, 1.95},    // kATK
+        {1.17, 1.46},    // kATKPercent
+        {1.85, 2.31},    // kDEF
+        {1.46, 1.82},    // kDEFPercent
+        {4.66, 5.83},    // kElementalMastery
+        {0.78, 0.97},    // kCritRate
+        {1.55, 1.94},    // kCritDMG
+        {},              // kHealingBonus
+        {1.30, 1.62},    // kEnergyRecharge
+        {},              // kPyroDMG
+        {},              // kHydroDMG
+        {},              // kDendroDMG
+        {},              // kElectroDMG
+        {},              // kAnemoDMG
+        {},              // kCryoDMG
+        {},              // kGeoDMG
+        {},              // kPhysicalDMG
+    },
+
+    {
+        {50.19, 60.95, 71.70},  // kHP
+        {1.63, 1.98, 2.33},     // kHPPercent
+        {3.27, 3.97, 4.67},     // kATK
+        {1.63, 1.98, 2.33},     // kATKPercent
+        {3.89, 4.72, 5.56},     // kDEF
+        {2.04, 2.48, 2.91},     // kDEFPercent
+        {6.53, 7.93, 9.33},     // kElementalMastery
+        {1.09, 1.32, 1.55},     // kCritRate
+        {2.18, 2.64, 3.11},     // kCritDMG
+        {},                     // kHealingBonus
+        {1.81, 2.20, 2.59},     // kEnergyRecharge
+        {},                     // kPyroDMG
+        {},                     // kHydroDMG
+        {},                     // kDendroDMG
+        {},                     // kElectroDMG
+        {},                     // kAnemoDMG
+        {},                     // kCryoDMG
+        {},                     // kGeoDMG
+        {},                     // kPhysicalDMG
+    },
+
+    {
+        {100.38, 114.72, 129.06, 143.40},  // kHP
+        {2.45, 2.80, 3.15, 3.50},          // kHPPercent
+        {6.54, 7.47, 8.40, 9.34},          // kATK
+        {2.45, 2.80, 3.15, 3.50},          // kATKPercent
+        {7.78, 8.89, 10.00, 11.11},        // kDEF
+        {3.06, 3.50, 3.93, 4.37},          // kDEFPercent
+        {9.79, 11.19, 12.59, 13.99},       // kElementalMastery
+        {1.63, 1.86, 2.10, 2.33},          // kCritRate
+        {3.26, 3.73, 4.20, 4.66},          // kCritDMG
+        {},                                // kHealingBonus
+        {2.72, 3.11, 3.50, 3.89},          // kEnergyRecharge
+        {},                                // kPyroDMG
+        {},                                // kHydroDMG
+        {},                                // kDendroDMG
+        {},                                // kElectroDMG
+        {},                                // kAnemoDMG
+        {},                                // kCryoDMG
+        {},                                // kGeoDMG
+        {},                                // kPhysicalDMG
+    },
+
+    {
+        {167.30, 191.20, 215.10, 239.00},  // kHP
+        {3.26, 3.73, 4.20, 4.66},          // kHPPercent
+        {10.89, 12.45, 14.00, 15.56},      // kATK
+        {3.26, 3.73, 4.20, 4.66},          // kATKPercent
+        {12.96, 14.82, 16.67, 18.52},      // kDEF
+        {4.08, 4.66, 5.25, 5.83},          // kDEFPercent
+        {13.06, 14.92, 16.79, 18.56},      // kElementalMastery
+        {2.18, 2.49, 2.80, 3.11},          // kCritRate
+        {4.35, 4.97, 5.60, 6.22},          // kCritDMG
+        {},                                // kHealingBonus
+        {3.63, 4.14, 4.66, 5.18},          // kEnergyRecharge
+        {},                                // kPyroDMG
+        {},                                // kHydroDMG
+        {},                                // kDendroDMG
+        {},                                // kElectroDMG
+        {},                                // kAnemoDMG
+        {},                                // kCryoDMG
+        {},                                // kGeoDMG
+        {},                                // kPhysicalDMG
+    },
+
+    {
+        {209.13, 239.00, 268.88, 298.75},  // kHP
+        {4.08, 4.66, 5.25, 5.83},          // kHPPercent
+        {13.62, 15.56, 17.51, 19.45},      // kATK
+        {4.08, 4.66, 5.25, 5.83},          // kATKPercent
+        {16.20, 18.52, 20.83, 23.15},      // kDEF
+        {5.10, 5.83, 6.56, 7.29},          // kDEFPercent
+        {16.32, 18.65, 20.98, 23.31},      // kElementalMastery
+        {2.72, 3.11, 3.50, 3.89},          // kCritRate
+        {5.44, 6.22, 6.99, 7.77},          // kCritDMG
+        {},                                // kHealingBonus
+        {4.53, 5.18, 5.83, 6.48},          // kEnergyRecharge
+        {},                                // kPyroDMG
+        {},                                // kHydroDMG
+        {},                                // kDendroDMG
+        {},                                // kElectroDMG
+        {},                                // kAnemoDMG
+        {},                                // kCryoDMG
+        {},                                // kGeoDMG
+        {},                                // kPhysicalDMG
+    },
+};
+
+// The number of possible unit substat differences of A-Star artifacts
+constexpr int kSubStatDiffCountList[6] = {0, 2, 3, 4, 4, 4};
+
+}  // namespace
+
 Artifact::Artifact(ItemStack* item, PlayerEx* playerex)
     : item_(item), playerex_(playerex) {
   // Check if the item is a GenshiCraft item
-  if (!Artifact::CheckIsArtifact(item)) {
+  auto classification = item::Classify(item);
+  if (classification.kind != item::Kind::kArtifact) {
     throw ExceptionNotAnArtifact();
   }
 
-  this->identifier_ =
-      item->getTypeName().substr(0, item->getTypeName().size() - 2);
-
-  this->rarity_ =
-      std::stoi(item->getTypeName().substr(item->getTypeName().size() - 1));
-  this->rarity_ = std::max(this->rarity_, 1);
-  this->rarity_ = std::min(this->rarity_, 5);
+  this->id_ = classification.id;
+  this->rarity_ = classification.rarity;
 
   auto nbt = item->getNbt();
 
@@ -79,50 +541,31 @@ Artifact::Artifact(ItemStack* item, PlayerEx* playerex)
 
     // Write to the item NBT
     nbt->put("tag", CompoundTag());
-
-    auto tag = nbt->getCompound("tag");
-    tag->put("genshicraft", CompoundTag());
-
-    auto data = tag->getCompound("genshicraft");
-    data->putInt("artifact_exp", this->artifact_exp_);  // the Artifact EXP
-
-    data->put("main_stat", CompoundTag());
-    data->getCompound("main_stat")
-        ->putInt("type", static_cast<int>(this->main_stat_.type));
-    data->getCompound("main_stat")->putDouble("value", this->main_stat_.value);
-
-    for (int i = 0; i < 4; ++i) {
-      data->put("sub_stat_" + std::to_string(i), CompoundTag());
-      data->getCompound("sub_stat_" + std::to_string(i))
-          ->putInt("type", static_cast<int>(this->sub_stat_list_.at(i).type));
-      data->getCompound("sub_stat_" + std::to_string(i))
-          ->putDouble("value", this->sub_stat_list_.at(i).value);
-    }
+    this->EncodeData(nbt->getCompound("tag"));
 
     item->setNbt(nbt.get());
 
     playerex->RefreshItems();
-  }
 
-  auto data = nbt->getCompound("tag")->getCompound("genshicraft");
+  } else {
+    auto data = nbt->getCompound("tag")->getCompound("genshicraft");
 
-  this->artifact_exp_ = data->getInt("artifact_exp");
+    Artifact::View view = {};
+    Artifact::DecodeData(data, &view);
 
-  this->main_stat_.type = static_cast<Artifact::StatType>(
-      data->getCompound("main_stat")->getInt("type"));
-  this->main_stat_.value = data->getCompound("main_stat")->getDouble("value");
+    this->artifact_exp_ = view.artifact_exp;
+    this->main_stat_ = view.main_stat;
+    this->sub_stat_list_.assign(std::begin(view.sub_stat_list),
+                                std::end(view.sub_stat_list));
 
-  this->sub_stat_list_.clear();
-  for (int i = 0; i < 4; ++i) {
-    Artifact::StatItem stat;
+    // Migrate the legacy layout on first touch
+    if (!data->contains("version")) {
+      this->EncodeData(nbt->getCompound("tag"));
 
-    stat.type = static_cast<Artifact::StatType>(
-        data->getCompound("sub_stat_" + std::to_string(i))->getInt("type"));
+      item->setNbt(nbt.get());
 
-    stat.value =
-        data->getCompound("sub_stat_" + std::to_string(i))->getDouble("value");
-
-    this->sub_stat_list_.push_back(stat);
+      playerex->RefreshItems();
+    }
   }
 
   this->ApplyLore();
@@ -130,32 +573,37 @@ Artifact::Artifact(ItemStack* item, PlayerEx* playerex)
 
 Artifact::~Artifact() {
   auto nbt = this->item_->getNbt();
-  auto data = nbt->getCompound("tag")->getCompound("genshicraft");
+  auto tag = nbt->getCompound("tag");
 
-  bool is_modified = false;
-  if (this->artifact_exp_ != data->getInt("artifact_exp")) {
-    is_modified = true;
-  }
+  Artifact::View view = {};
+  Artifact::DecodeData(tag->getCompound("genshicraft"), &view);
+
+  // The stats only change with the artifact EXP
+  if (this->artifact_exp_ != view.artifact_exp) {
+    this->EncodeData(tag);
 
-  data->putInt("artifact_exp", this->artifact_exp_);  // the Artifact EXP
+    this->item_->setNbt(nbt.get());
+    this->playerex_->RefreshItems();
+  }
+}
 
-  data->put("main_stat", CompoundTag());
-  data->getCompound("main_stat")
-      ->putInt("type", static_cast<int>(this->main_stat_.type));
-  data->getCompound("main_stat")->putDouble("value", this->main_stat_.value);
+bool Artifact::View::operator==(const Artifact::View& other) const {
+  if (this->artifact_exp != other.artifact_exp || this->info != other.info ||
+      this->is_initialized != other.is_initialized ||
+      this->rarity != other.rarity ||
+      this->main_stat.type != other.main_stat.type ||
+      this->main_stat.value != other.main_stat.value) {
+    return false;
+  }
 
   for (int i = 0; i < 4; ++i) {
-    data->put("sub_stat_" + std::to_string(i), CompoundTag());
-    data->getCompound("sub_stat_" + std::to_string(i))
-        ->putInt("type", static_cast<int>(this->sub_stat_list_.at(i).type));
-    data->getCompound("sub_stat_" + std::to_string(i))
-        ->putDouble("value", this->sub_stat_list_.at(i).value);
+    if (this->sub_stat_list[i].type != other.sub_stat_list[i].type ||
+        this->sub_stat_list[i].value != other.sub_stat_list[i].value) {
+      return false;
+    }
   }
 
-  if (is_modified) {
-    this->item_->setNbt(nbt.get());
-    this->playerex_->RefreshItems();
-  }
+  return true;
 }
 
 void Artifact::ApplyLore() {
@@ -215,96 +663,11 @@ int Artifact::GetBaseConsumableEXP() const {
 };
 
 Stats Artifact::GetBaseStats() const {
-  Stats stats;
-
-  std::vector<Artifact::StatItem> stat_list = {
+  Artifact::StatItem stat_list[] = {
       this->main_stat_, this->sub_stat_list_[0], this->sub_stat_list_[1],
       this->sub_stat_list_[2], this->sub_stat_list_[3]};
 
-  for (const auto& stat : stat_list) {
-    switch (stat.type) {
-      case Artifact::StatType::kHP:
-        stats.max_HP_ext = static_cast<int>(stat.value);
-        break;
-
-      case Artifact::StatType::kHPPercent:
-        stats.max_HP_percent = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kATK:
-        stats.ATK_ext = static_cast<int>(stat.value);
-        break;
-
-      case Artifact::StatType::kATKPercent:
-        stats.ATK_percent = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kDEF:
-        stats.DEF_ext = static_cast<int>(stat.value);
-        break;
-
-      case Artifact::StatType::kDEFPercent:
-        stats.DEF_percent = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kElementalMastery:
-        stats.elemental_mastery = static_cast<int>(stat.value);
-        break;
-
-      case Artifact::StatType::kCritRate:
-        stats.CRIT_rate = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kCritDMG:
-        stats.CRIT_DMG = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kHealingBonus:
-        stats.healing_bonus = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kEnergyRecharge:
-        stats.energy_recharge = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kPyroDMG:
-        stats.pyro_DMG_bonus = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kHydroDMG:
-        stats.hydro_DMG_bonus = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kDendroDMG:
-        stats.dendro_DMG_bonus = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kElectroDMG:
-        stats.electro_DMG_bonus = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kAnemoDMG:
-        stats.anemo_DMG_bonus = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kCryoDMG:
-        stats.cryo_DMG_bonus = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kGeoDMG:
-        stats.geo_DMG_bonus = stat.value / 100;
-        break;
-
-      case Artifact::StatType::kPhysicalDMG:
-        stats.physical_DMG_bonus = stat.value / 100;
-        break;
-
-      default:
-        break;
-    }
-  }
-
-  return stats;
+  return Artifact::ConvertStatItems(stat_list, 5);
 }
 
 std::vector<std::string> Artifact::GetBaseStatsDescription() const {
@@ -483,37 +846,29 @@ int Artifact::GetLevel() const {
 }
 
 int Artifact::GetLevelMax() const {
-  return Artifact::kRarityMaxLevelList[this->rarity_];
+  return Artifact::kLevelTableList[this->rarity_].GetMaxLevel();
 }
 
 int Artifact::GetLevelByArtifactEXP(int artifact_exp) const {
-  auto rarity = this->GetRarity();
-
-  // Get the level by the artifact EXP
-  int level = 0;
-  for (int i = 0; i <= this->GetLevelMax(); ++i) {
-    if (Artifact::kLevelMinArtifactEXPList[rarity][i] <= artifact_exp) {
-      level = i;
-    } else {
-      break;
-    }
-  }
-
-  return level;
+  return Artifact::kLevelTableList[this->GetRarity()].GetLevel(artifact_exp);
 }
 
 std::string Artifact::GetName() const {
-  return Artifact::kArtifactInfoDict.at(this->identifier_).name;
+  return kArtifactInfoList[this->id_].name;
 }
 
 int Artifact::GetRarity() const { return this->rarity_; }
 
+int Artifact::GetSetID() const {
+  return kArtifactInfoList[this->id_].set_id;
+}
+
 std::string Artifact::GetSetName() const {
-  return Artifact::kArtifactInfoDict.at(this->identifier_).set_name;
+  return Artifact::kSetInfoList[this->GetSetID()].name;
 }
 
 Artifact::Type Artifact::GetType() const {
-  return Artifact::kArtifactInfoDict.at(this->identifier_).type;
+  return kArtifactInfoList[this->id_].type;
 }
 
 void Artifact::IncreaseArtifactEXP(int value) {
@@ -528,74 +883,134 @@ void Artifact::IncreaseArtifactEXP(int value) {
 
   if (this->GetLevel() > previous_level) {
     this->main_stat_.value =
-        Artifact::kMainStatBase[this->rarity_].at(this->main_stat_.type) +
-        this->GetLevel() *
-            Artifact::kMainStatDiff[this->rarity_].at(this->main_stat_.type);
+        kMainStatBaseList[this->rarity_]
+                                   [static_cast<int>(this->main_stat_.type)] +
+        this->GetLevel() * kMainStatDiffList[this->rarity_][
+                               static_cast<int>(this->main_stat_.type)];
   }
 
   if (this->GetLevel() % 4 == 0 && previous_level % 4 != 0) {
     // Enhance the zero-value stats first
     for (int i = 0; i < 4; ++i) {
       if (this->sub_stat_list_.at(i).value < 0.0001) {
-        auto possible_diff_list =
-            Artifact::kPossibleSubStatDiff[this->rarity_].at(
-                this->sub_stat_list_.at(i).type);
+        const auto& possible_diff_list =
+            kSubStatDiffList[this->rarity_][static_cast<int>(
+                this->sub_stat_list_.at(i).type)];
 
         this->sub_stat_list_.at(i).value +=
-            possible_diff_list.at(std::uniform_int_distribution(
-                0, static_cast<int>(possible_diff_list.size() - 1))(
-                random_engine));
+            possible_diff_list[std::uniform_int_distribution(
+                0, kSubStatDiffCountList[this->rarity_] - 1)(
+                random_engine)];
         return;
       }
     }
 
     // Enhance a random stat
     auto stat_no = std::uniform_int_distribution(0, 3)(random_engine);
-    auto possible_diff_list = Artifact::kPossibleSubStatDiff[this->rarity_].at(
-        this->sub_stat_list_.at(stat_no).type);
+    const auto& possible_diff_list =
+        kSubStatDiffList[this->rarity_][static_cast<int>(
+            this->sub_stat_list_.at(stat_no).type)];
     this->sub_stat_list_.at(stat_no).value +=
-        possible_diff_list.at(std::uniform_int_distribution(
-            0, static_cast<int>(possible_diff_list.size() - 1))(random_engine));
+        possible_diff_list[std::uniform_int_distribution(
+            0, kSubStatDiffCountList[this->rarity_] - 1)(
+            random_engine)];
   }
 }
 
 bool Artifact::CheckIsArtifact(ItemStack* item) {
-  auto identifier = item->getTypeName();
+  return item::Classify(item).kind == item::Kind::kArtifact;
+}
 
-  identifier = identifier.substr(0, identifier.size() - 2);
+int Artifact::GetArtifactID(std::string_view identifier) {
+  static_assert(kArtifactHashSeed != kNoPerfectHashSeed,
+                "No perfect hash is found for the artifact identifiers");
 
-  for (const auto& artifact_info : Artifact::kArtifactInfoDict) {
-    if (identifier == artifact_info.first) {
-      return true;
-    }
+  auto id = kArtifactIDTable[HashIdentifier(identifier, kArtifactHashSeed) %
+                            kArtifactIDTableSize];
+
+  // Identifiers outside the table may still hash to an occupied slot
+  if (id == -1 || identifier != kArtifactInfoList[id].identifier) {
+    return -1;
   }
 
-  return false;
+  return id;
 }
 
-int Artifact::GetSetCount(const std::string& set_name, PlayerEx* playerex) {
-  int set_count = 0;
-  for (auto artifact_pair : playerex->GetArtifactDict()) {
-    auto artifact = artifact_pair.second;
-    if (artifact->GetSetName() == set_name) {
-      ++set_count;
-    }
-  }
+Stats Artifact::GetBaseStats(const Artifact::View& view) {
+  Artifact::StatItem stat_list[] = {
+      view.main_stat, view.sub_stat_list[0], view.sub_stat_list[1],
+      view.sub_stat_list[2], view.sub_stat_list[3]};
 
-  return set_count;
+  return Artifact::ConvertStatItems(stat_list, 5);
 }
 
-std::vector<std::string> Artifact::GetSetEffectDescription(
-    const std::string& set_name) {
-  return Artifact::kSetEffectDescriptionDict.at(set_name);
+int Artifact::GetSetCount(int set_id, PlayerEx* playerex) {
+  return playerex->GetArtifactSummary().set_count_list[set_id];
+}
+
+const std::vector<std::string>& Artifact::GetSetEffectDescription(
+    int set_id) {
+  return Artifact::kSetInfoList[set_id].effect_description_list;
 }
 
 std::shared_ptr<Artifact> Artifact::Make(ItemStack* item, PlayerEx* playerex) {
-  if (!Artifact::CheckIsArtifact(item)) {
+  // The constructor throws ExceptionNotAnArtifact for other items
+  return std::make_shared<Artifact>(item, playerex);
+}
+
+Artifact::View Artifact::MakeView(ItemStack* item) {
+  auto classification = item::Classify(item);
+  if (classification.kind != item::Kind::kArtifact) {
     throw ExceptionNotAnArtifact();
   }
 
-  return std::make_shared<Artifact>(item, playerex);
+  Artifact::View view = {};
+
+  view.info = &kArtifactInfoList[classification.id];
+  view.rarity = classification.rarity;
+  view.base_consumable_exp =
+      Artifact::kRarityBaseConsumableEXPList[view.rarity];
+
+  // Uninitialized artifacts have no stats and no artifact EXP yet
+  auto nbt = item->getNbt();
+  if (!nbt->contains("tag") ||
+      !nbt->getCompound("tag")->contains("genshicraft")) {
+    view.is_initialized = false;
+    return view;
+  }
+
+  view.is_initialized = true;
+
+  // Legacy data is decoded as is, since views never write the item
+  Artifact::DecodeData(
+      nbt->getCompound("tag")->getCompound("genshicraft"), &view);
+
+  return view;
+}
+
+void Artifact::EncodeData(CompoundTag* tag) const {
+  auto data = CompoundTag::create();
+
+  data->putInt("version", Artifact::kDataVersion);
+
+  // [artifact EXP, main stat type, sub stat types...]
+  auto int_list = ListTag::create();
+  int_list->addInt(this->artifact_exp_);
+  int_list->addInt(static_cast<int>(this->main_stat_.type));
+  for (const auto& sub_stat : this->sub_stat_list_) {
+    int_list->addInt(static_cast<int>(sub_stat.type));
+  }
+  data->put("int_list", std::move(int_list));
+
+  // [main stat value, sub stat values...]
+  auto double_list = ListTag::create();
+  double_list->addDouble(this->main_stat_.value);
+  for (const auto& sub_stat : this->sub_stat_list_) {
+    double_list->addDouble(sub_stat.value);
+  }
+  data->put("double_list", std::move(double_list));
+
+  tag->put("genshicraft", std::move(data));
 }
 
 void Artifact::InitStats() {
@@ -605,12 +1020,14 @@ void Artifact::InitStats() {
   if (this->GetType() == Artifact::Type::kFlowerOfLife) {
     this->main_stat_.type = Artifact::StatType::kHP;
     this->main_stat_.value =
-        Artifact::kMainStatBase[this->rarity_].at(this->main_stat_.type);
+        kMainStatBaseList[this->rarity_]
+                                   [static_cast<int>(this->main_stat_.type)];
 
   } else if (this->GetType() == Artifact::Type::kPlumeOfDeath) {
     this->main_stat_.type = Artifact::StatType::kATK;
     this->main_stat_.value =
-        Artifact::kMainStatBase[this->rarity_].at(this->main_stat_.type);
+        kMainStatBaseList[this->rarity_]
+                                   [static_cast<int>(this->main_stat_.type)];
 
   } else if (this->GetType() == Artifact::Type::kSandsOfEon) {
     std::vector<Artifact::StatType> possible_main_stat_list = {
@@ -621,7 +1038,8 @@ void Artifact::InitStats() {
     this->main_stat_.type = possible_main_stat_list.at(
         std::uniform_int_distribution(0, 4)(random_engine));
     this->main_stat_.value =
-        Artifact::kMainStatBase[this->rarity_].at(this->main_stat_.type);
+        kMainStatBaseList[this->rarity_]
+                                   [static_cast<int>(this->main_stat_.type)];
   } else if (this->GetType() == Artifact::Type::kGobletOfEonothem) {
     std::vector<Artifact::StatType> possible_main_stat_list = {
         Artifact::StatType::kHPPercent,  Artifact::StatType::kATKPercent,
@@ -634,7 +1052,8 @@ void Artifact::InitStats() {
     this->main_stat_.type = possible_main_stat_list.at(
         std::uniform_int_distribution(0, 11)(random_engine));
     this->main_stat_.value =
-        Artifact::kMainStatBase[this->rarity_].at(this->main_stat_.type);
+        kMainStatBaseList[this->rarity_]
+                                   [static_cast<int>(this->main_stat_.type)];
   } else if (this->GetType() == Artifact::Type::kCircletOfLogos) {
     std::vector<Artifact::StatType> possible_main_stat_list = {
         Artifact::StatType::kHPPercent,  Artifact::StatType::kATKPercent,
@@ -644,7 +1063,8 @@ void Artifact::InitStats() {
     this->main_stat_.type = possible_main_stat_list.at(
         std::uniform_int_distribution(0, 5)(random_engine));
     this->main_stat_.value =
-        Artifact::kMainStatBase[this->rarity_].at(this->main_stat_.type);
+        kMainStatBaseList[this->rarity_]
+                                   [static_cast<int>(this->main_stat_.type)];
   }
 
   // Initialize the sub stats
@@ -682,37 +1102,162 @@ void Artifact::InitStats() {
     stat_item.type = possible_sub_stat_list.at(i);
     stat_item.value = 0.;
     if (i < sub_stat_count) {
-      auto sub_stat_diff_list =
-          Artifact::kPossibleSubStatDiff[this->rarity_].at(stat_item.type);
-      stat_item.value = sub_stat_diff_list.at(std::uniform_int_distribution(
-          0, static_cast<int>(sub_stat_diff_list.size() - 1))(random_engine));
+      const auto& sub_stat_diff_list =
+          kSubStatDiffList[this->rarity_]
+                                    [static_cast<int>(stat_item.type)];
+      stat_item.value = sub_stat_diff_list[std::uniform_int_distribution(
+          0, kSubStatDiffCountList[this->rarity_] - 1)(
+          random_engine)];
     }
     this->sub_stat_list_.push_back(stat_item);
   }
 }
 
+Stats Artifact::ConvertStatItems(const Artifact::StatItem* stat_list,
+                                 int count) {
+  Stats stats;
+
+  for (int i = 0; i < count; ++i) {
+    const auto& stat = stat_list[i];
+
+    switch (stat.type) {
+      case Artifact::StatType::kHP:
+        stats.max_HP_ext = static_cast<int>(stat.value);
+        break;
+
+      case Artifact::StatType::kHPPercent:
+        stats.max_HP_percent = stat.value / 100;
+        break;
+
+      case Artifact::StatType::kATK:
+        stats.ATK_ext = static_cast<int>(stat.value);
+        break;
+
+      case Artifact::StatType::kATKPercent:
+        stats.ATK_percent = stat.value / 100;
+        break;
+
+      case Artifact::StatType::kDEF:
+        stats.DEF_ext = static_cast<int>(stat.value);
+        break;
+
+      case Artifact::StatType::kDEFPercent:
+        stats.DEF_percent = stat.value / 100;
+        break;
+
+      case Artifact::StatType::kElementalMastery:
+        stats.elemental_mastery = static_cast<int>(stat.value);
+        break;
+
+      case Artifact::StatType::kCritRate:
+        stats.CRIT_rate = stat.value / 100;
+        break;
+
+      case Artifact::StatType::kCritDMG:
+        stats.CRIT_DMG = stat.value / 100;
+        break;
+
+      case Artifact::StatType::kHealingBonus:
+        stats.healing_bonus = stat.value / 100;
+        break;
+
+      case Artifact::StatType::kEnergyRecharge:
+        stats.energy_recharge = stat.value / 100;
+        break;
+
+      case Artifact::StatType::kPyroDMG:
+        stats.DMG_bonus[static_cast<int>(world::ElementType::kPyro)] =
+            stat.value / 100;
+        break;
+
+      case Artifact::StatType::kHydroDMG:
+        stats.DMG_bonus[static_cast<int>(world::ElementType::kHydro)] =
+            stat.value / 100;
+        break;
+
+      case Artifact::StatType::kDendroDMG:
+        stats.DMG_bonus[static_cast<int>(world::ElementType::kDendro)] =
+            stat.value / 100;
+        break;
+
+      case Artifact::StatType::kElectroDMG:
+        stats.DMG_bonus[static_cast<int>(world::ElementType::kElectro)] =
+            stat.value / 100;
+        break;
+
+      case Artifact::StatType::kAnemoDMG:
+        stats.DMG_bonus[static_cast<int>(world::ElementType::kAnemo)] =
+            stat.value / 100;
+        break;
+
+      case Artifact::StatType::kCryoDMG:
+        stats.DMG_bonus[static_cast<int>(world::ElementType::kCryo)] =
+            stat.value / 100;
+        break;
+
+      case Artifact::StatType::kGeoDMG:
+        stats.DMG_bonus[static_cast<int>(world::ElementType::kGeo)] =
+            stat.value / 100;
+        break;
+
+      case Artifact::StatType::kPhysicalDMG:
+        stats.DMG_bonus[static_cast<int>(world::ElementType::kPhysical)] =
+            stat.value / 100;
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  return stats;
+}
+
+void Artifact::DecodeData(CompoundTag* data, Artifact::View* view) {
+  if (data->contains("version")) {
+    auto int_list = data->getList("int_list");
+    auto double_list = data->getList("double_list");
+
+    // Leave malformed data as zeros
+    if (int_list == nullptr || int_list->size() != 6 ||
+        double_list == nullptr || double_list->size() != 5) {
+      return;
+    }
+
+    view->artifact_exp = int_list->getInt(0);
+    view->main_stat.type = static_cast<Artifact::StatType>(int_list->getInt(1));
+    view->main_stat.value = double_list->getDouble(0);
+    for (int i = 0; i < 4; ++i) {
+      view->sub_stat_list[i].type =
+          static_cast<Artifact::StatType>(int_list->getInt(i + 2));
+      view->sub_stat_list[i].value = double_list->getDouble(i + 1);
+    }
+
+    return;
+  }
+
+  // The legacy layout
+  view->artifact_exp = data->getInt("artifact_exp");
+
+  view->main_stat.type = static_cast<Artifact::StatType>(
+      data->getCompound("main_stat")->getInt("type"));
+  view->main_stat.value = data->getCompound("main_stat")->getDouble("value");
+
+  for (int i = 0; i < 4; ++i) {
+    auto stat_data = data->getCompound("sub_stat_" + std::to_string(i));
+    view->sub_stat_list[i].type =
+        static_cast<Artifact::StatType>(stat_data->getInt("type"));
+    view->sub_stat_list[i].value = stat_data->getDouble("value");
+  }
+}
+
 const int Artifact::kRarityBaseConsumableEXPList[6] = {0,    420,  840,
                                                        1260, 2520, 3780};
 
-const std::map<std::string, Artifact::ArtifactInfo>
-    Artifact::kArtifactInfoDict = {
-        {"genshicraft:adventurer_s_flower",
-         {"Adventurer's Flower", "Adventurer", Artifact::Type::kFlowerOfLife}},
-        {"genshicraft:adventurer_s_tail_feather",
-         {"Adventurer's Tail Feather", "Adventurer",
-          Artifact::Type::kPlumeOfDeath}},
-        {"genshicraft:adventurer_s_pocket_watch",
-         {"Adventurer's Pocket Watch", "Adventurer",
-          Artifact::Type::kSandsOfEon}},
-        {"genshicraft:adventurer_s_golden_goblet",
-         {"Adventurer's Golden Goblet", "Adventurer",
-          Artifact::Type::kGobletOfEonothem}},
-        {"genshicraft:adventurer_s_bandana",
-         {"Adventurer's Bandana", "Adventurer",
-          Artifact::Type::kCircletOfLogos}},
-};
+namespace {
 
-const int Artifact::kLevelMinArtifactEXPList[6][21] = {
+// [A][B] means the minimum artifact EXP for A-Star artifacts to reach level B.
+constexpr int kLevelMinArtifactEXPList[6][21] = {
     {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
 
     {0,      600,    1350,   2225,   3250,   999999, 999999,
@@ -736,281 +1281,43 @@ const int Artifact::kLevelMinArtifactEXPList[6][21] = {
      115325, 132925, 153300, 176800, 203850, 234900, 270475},
 };
 
-const std::map<Artifact::StatType, double> Artifact::kMainStatBase[6] = {
-    {},
-
-    {{Artifact::StatType::kHP, 129},
-     {Artifact::StatType::kATK, 8},
-     {Artifact::StatType::kHPPercent, 3.1},
-     {Artifact::StatType::kATKPercent, 3.1},
-     {Artifact::StatType::kDEFPercent, 3.9},
-     {Artifact::StatType::kPhysicalDMG, 3.9},
-     {Artifact::StatType::kPyroDMG, 3.1},
-     {Artifact::StatType::kHydroDMG, 3.1},
-     {Artifact::StatType::kDendroDMG, 3.1},
-     {Artifact::StatType::kElectroDMG, 3.1},
-     {Artifact::StatType::kAnemoDMG, 3.1},
-     {Artifact::StatType::kCryoDMG, 3.1},
-     {Artifact::StatType::kGeoDMG, 3.1},
-     {Artifact::StatType::kElementalMastery, 12.6},
-     {Artifact::StatType::kEnergyRecharge, 3.5},
-     {Artifact::StatType::kCritRate, 2.1},
-     {Artifact::StatType::kCritDMG, 4.2},
-     {Artifact::StatType::kHealingBonus, 2.4}},
-
-    {{Artifact::StatType::kHP, 258},
-     {Artifact::StatType::kATK, 17},
-     {Artifact::StatType::kHPPercent, 4.2},
-     {Artifact::StatType::kATKPercent, 4.2},
-     {Artifact::StatType::kDEFPercent, 5.2},
-     {Artifact::StatType::kPhysicalDMG, 5.2},
-     {Artifact::StatType::kPyroDMG, 4.2},
-     {Artifact::StatType::kHydroDMG, 4.2},
-     {Artifact::StatType::kDendroDMG, 4.2},
-     {Artifact::StatType::kElectroDMG, 4.2},
-     {Artifact::StatType::kAnemoDMG, 4.2},
-     {Artifact::StatType::kCryoDMG, 4.2},
-     {Artifact::StatType::kGeoDMG, 4.2},
-     {Artifact::StatType::kElementalMastery, 16.8},
-     {Artifact::StatType::kEnergyRecharge, 4.7},
-     {Artifact::StatType::kCritRate, 2.8},
-     {Artifact::StatType::kCritDMG, 5.6},
-     {Artifact::StatType::kHealingBonus, 3.2}},
-
-    {{Artifact::StatType::kHP, 430},
-     {Artifact::StatType::kATK, 28},
-     {Artifact::StatType::kHPPercent, 5.2},
-     {Artifact::StatType::kATKPercent, 5.2},
-     {Artifact::StatType::kDEFPercent, 6.6},
-     {Artifact::StatType::kPhysicalDMG, 6.6},
-     {Artifact::StatType::kPyroDMG, 5.2},
-     {Artifact::StatType::kHydroDMG, 5.2},
-     {Artifact::StatType::kDendroDMG, 5.2},
-     {Artifact::StatType::kElectroDMG, 5.2},
-     {Artifact::StatType::kAnemoDMG, 5.2},
-     {Artifact::StatType::kCryoDMG, 5.2},
-     {Artifact::StatType::kGeoDMG, 5.2},
-     {Artifact::StatType::kElementalMastery, 21.},
-     {Artifact::StatType::kEnergyRecharge, 5.8},
-     {Artifact::StatType::kCritRate, 3.5},
-     {Artifact::StatType::kCritDMG, 7.},
-     {Artifact::StatType::kHealingBonus, 4.}},
-
-    {{Artifact::StatType::kHP, 645},
-     {Artifact::StatType::kATK, 42},
-     {Artifact::StatType::kHPPercent, 6.3},
-     {Artifact::StatType::kATKPercent, 6.3},
-     {Artifact::StatType::kDEFPercent, 7.9},
-     {Artifact::StatType::kPhysicalDMG, 7.9},
-     {Artifact::StatType::kPyroDMG, 6.3},
-     {Artifact::StatType::kHydroDMG, 6.3},
-     {Artifact::StatType::kDendroDMG, 6.3},
-     {Artifact::StatType::kElectroDMG, 6.3},
-     {Artifact::StatType::kAnemoDMG, 6.3},
-     {Artifact::StatType::kCryoDMG, 6.3},
-     {Artifact::StatType::kGeoDMG, 6.3},
-     {Artifact::StatType::kElementalMastery, 25.2},
-     {Artifact::StatType::kEnergyRecharge, 7.},
-     {Artifact::StatType::kCritRate, 4.2},
-     {Artifact::StatType::kCritDMG, 8.4},
-     {Artifact::StatType::kHealingBonus, 4.8}},
-
-    {{Artifact::StatType::kHP, 717},
-     {Artifact::StatType::kATK, 47},
-     {Artifact::StatType::kHPPercent, 7.0},
-     {Artifact::StatType::kATKPercent, 7.0},
-     {Artifact::StatType::kDEFPercent, 8.7},
-     {Artifact::StatType::kPhysicalDMG, 8.7},
-     {Artifact::StatType::kPyroDMG, 7.0},
-     {Artifact::StatType::kHydroDMG, 7.0},
-     {Artifact::StatType::kDendroDMG, 7.0},
-     {Artifact::StatType::kElectroDMG, 7.0},
-     {Artifact::StatType::kAnemoDMG, 7.0},
-     {Artifact::StatType::kCryoDMG, 7.0},
-     {Artifact::StatType::kGeoDMG, 7.0},
-     {Artifact::StatType::kElementalMastery, 28.},
-     {Artifact::StatType::kEnergyRecharge, 7.8},
-     {Artifact::StatType::kCritRate, 4.7},
-     {Artifact::StatType::kCritDMG, 9.3},
-     {Artifact::StatType::kHealingBonus, 5.4}}};
-
-const std::map<Artifact::StatType, double> Artifact::kMainStatDiff[6] = {
-    {},
-
-    {{Artifact::StatType::kHP, 48.75},
-     {Artifact::StatType::kATK, 3.25},
-     {Artifact::StatType::kHPPercent, 1.2},
-     {Artifact::StatType::kATKPercent, 1.2},
-     {Artifact::StatType::kDEFPercent, 1.5},
-     {Artifact::StatType::kPhysicalDMG, 1.5},
-     {Artifact::StatType::kPyroDMG, 1.2},
-     {Artifact::StatType::kHydroDMG, 1.2},
-     {Artifact::StatType::kDendroDMG, 1.2},
-     {Artifact::StatType::kElectroDMG, 1.2},
-     {Artifact::StatType::kAnemoDMG, 1.2},
-     {Artifact::StatType::kCryoDMG, 1.2},
-     {Artifact::StatType::kGeoDMG, 1.2},
-     {Artifact::StatType::kElementalMastery, 4.75},
-     {Artifact::StatType::kEnergyRecharge, 1.325},
-     {Artifact::StatType::kCritRate, 0.8},
-     {Artifact::StatType::kCritDMG, 1.575},
-     {Artifact::StatType::kHealingBonus, 0.925}},
-
-    {{Artifact::StatType::kHP, 73.25},
-     {Artifact::StatType::kATK, 4.75},
-     {Artifact::StatType::kHPPercent, 1.2},
-     {Artifact::StatType::kATKPercent, 1.2},
-     {Artifact::StatType::kDEFPercent, 1.5},
-     {Artifact::StatType::kPhysicalDMG, 1.5},
-     {Artifact::StatType::kPyroDMG, 1.2},
-     {Artifact::StatType::kHydroDMG, 1.2},
-     {Artifact::StatType::kDendroDMG, 1.2},
-     {Artifact::StatType::kElectroDMG, 1.2},
-     {Artifact::StatType::kAnemoDMG, 1.2},
-     {Artifact::StatType::kCryoDMG, 1.2},
-     {Artifact::StatType::kGeoDMG, 1.2},
-     {Artifact::StatType::kElementalMastery, 4.75},
-     {Artifact::StatType::kEnergyRecharge, 1.3},
-     {Artifact::StatType::kCritRate, 0.8},
-     {Artifact::StatType::kCritDMG, 1.575},
-     {Artifact::StatType::kHealingBonus, 0.925}},
-
-    {{Artifact::StatType::kHP, 121.917},
-     {Artifact::StatType::kATK, 7.917},
-     {Artifact::StatType::kHPPercent, 1.492},
-     {Artifact::StatType::kATKPercent, 1.492},
-     {Artifact::StatType::kDEFPercent, 1.850},
-     {Artifact::StatType::kPhysicalDMG, 1.850},
-     {Artifact::StatType::kPyroDMG, 1.492},
-     {Artifact::StatType::kHydroDMG, 1.492},
-     {Artifact::StatType::kDendroDMG, 1.492},
-     {Artifact::StatType::kElectroDMG, 1.492},
-     {Artifact::StatType::kAnemoDMG, 1.492},
-     {Artifact::StatType::kCryoDMG, 1.492},
-     {Artifact::StatType::kGeoDMG, 1.492},
-     {Artifact::StatType::kElementalMastery, 5.942},
-     {Artifact::StatType::kEnergyRecharge, 1.65},
-     {Artifact::StatType::kCritRate, 0.992},
-     {Artifact::StatType::kCritDMG, 1.983},
-     {Artifact::StatType::kHealingBonus, 1.15}},
-
-    {{Artifact::StatType::kHP, 182.875},
-     {Artifact::StatType::kATK, 11.875},
-     {Artifact::StatType::kHPPercent, 1.781},
-     {Artifact::StatType::kATKPercent, 1.781},
-     {Artifact::StatType::kDEFPercent, 2.225},
-     {Artifact::StatType::kPhysicalDMG, 2.225},
-     {Artifact::StatType::kPyroDMG, 1.781},
-     {Artifact::StatType::kHydroDMG, 1.781},
-     {Artifact::StatType::kDendroDMG, 1.781},
-     {Artifact::StatType::kElectroDMG, 1.781},
-     {Artifact::StatType::kAnemoDMG, 1.781},
-     {Artifact::StatType::kCryoDMG, 1.781},
-     {Artifact::StatType::kGeoDMG, 1.781},
-     {Artifact::StatType::kElementalMastery, 7.131},
-     {Artifact::StatType::kEnergyRecharge, 1.981},
-     {Artifact::StatType::kCritRate, 1.188},
-     {Artifact::StatType::kCritDMG, 2.375},
-     {Artifact::StatType::kHealingBonus, 1.375}},
-
-    {{Artifact::StatType::kHP, 203.15},
-     {Artifact::StatType::kATK, 13.2},
-     {Artifact::StatType::kHPPercent, 1.98},
-     {Artifact::StatType::kATKPercent, 1.98},
-     {Artifact::StatType::kDEFPercent, 2.48},
-     {Artifact::StatType::kPhysicalDMG, 2.48},
-     {Artifact::StatType::kPyroDMG, 1.98},
-     {Artifact::StatType::kHydroDMG, 1.98},
-     {Artifact::StatType::kDendroDMG, 1.98},
-     {Artifact::StatType::kElectroDMG, 1.98},
-     {Artifact::StatType::kAnemoDMG, 1.98},
-     {Artifact::StatType::kCryoDMG, 1.98},
-     {Artifact::StatType::kGeoDMG, 1.98},
-     {Artifact::StatType::kElementalMastery, 7.925},
-     {Artifact::StatType::kEnergyRecharge, 2.2},
-     {Artifact::StatType::kCritRate, 1.32},
-     {Artifact::StatType::kCritDMG, 2.645},
-     {Artifact::StatType::kHealingBonus, 1.525}}};
-
-const std::map<Artifact::StatType, std::vector<double>>
-    Artifact::kPossibleSubStatDiff[6] = {
-        {},
-
-        {
-            {Artifact::StatType::kHP, {23.90, 29.88}},
-            {Artifact::StatType::kATK, {1.56, 1.95}},
-            {Artifact::StatType::kDEF, {1.85, 2.31}},
-            {Artifact::StatType::kHPPercent, {1.17, 1.46}},
-            {Artifact::StatType::kATKPercent, {1.17, 1.46}},
-            {Artifact::StatType::kDEFPercent, {1.46, 1.82}},
-            {Artifact::StatType::kElementalMastery, {4.66, 5.83}},
-            {Artifact::StatType::kEnergyRecharge, {1.30, 1.62}},
-            {Artifact::StatType::kCritRate, {0.78, 0.97}},
-            {Artifact::StatType::kCritDMG, {1.55, 1.94}},
-        },
-
-        {
-            {Artifact::StatType::kHP, {50.19, 60.95, 71.70}},
-            {Artifact::StatType::kATK, {3.27, 3.97, 4.67}},
-            {Artifact::StatType::kDEF, {3.89, 4.72, 5.56}},
-            {Artifact::StatType::kHPPercent, {1.63, 1.98, 2.33}},
-            {Artifact::StatType::kATKPercent, {1.63, 1.98, 2.33}},
-            {Artifact::StatType::kDEFPercent, {2.04, 2.48, 2.91}},
-            {Artifact::StatType::kElementalMastery, {6.53, 7.93, 9.33}},
-            {Artifact::StatType::kEnergyRecharge, {1.81, 2.20, 2.59}},
-            {Artifact::StatType::kCritRate, {1.09, 1.32, 1.55}},
-            {Artifact::StatType::kCritDMG, {2.18, 2.64, 3.11}},
-        },
-
-        {
-            {Artifact::StatType::kHP, {100.38, 114.72, 129.06, 143.40}},
-            {Artifact::StatType::kATK, {6.54, 7.47, 8.40, 9.34}},
-            {Artifact::StatType::kDEF, {7.78, 8.89, 10.00, 11.11}},
-            {Artifact::StatType::kHPPercent, {2.45, 2.80, 3.15, 3.50}},
-            {Artifact::StatType::kATKPercent, {2.45, 2.80, 3.15, 3.50}},
-            {Artifact::StatType::kDEFPercent, {3.06, 3.50, 3.93, 4.37}},
-            {Artifact::StatType::kElementalMastery,
-             {9.79, 11.19, 12.59, 13.99}},
-            {Artifact::StatType::kEnergyRecharge, {2.72, 3.11, 3.50, 3.89}},
-            {Artifact::StatType::kCritRate, {1.63, 1.86, 2.10, 2.33}},
-            {Artifact::StatType::kCritDMG, {3.26, 3.73, 4.20, 4.66}},
-        },
-
-        {
-            {Artifact::StatType::kHP, {167.30, 191.20, 215.10, 239.00}},
-            {Artifact::StatType::kATK, {10.89, 12.45, 14.00, 15.56}},
-            {Artifact::StatType::kDEF, {12.96, 14.82, 16.67, 18.52}},
-            {Artifact::StatType::kHPPercent, {3.26, 3.73, 4.20, 4.66}},
-            {Artifact::StatType::kATKPercent, {3.26, 3.73, 4.20, 4.66}},
-            {Artifact::StatType::kDEFPercent, {4.08, 4.66, 5.25, 5.83}},
-            {Artifact::StatType::kElementalMastery,
-             {13.06, 14.92, 16.79, 18.56}},
-            {Artifact::StatType::kEnergyRecharge, {3.63, 4.14, 4.66, 5.18}},
-            {Artifact::StatType::kCritRate, {2.18, 2.49, 2.80, 3.11}},
-            {Artifact::StatType::kCritDMG, {4.35, 4.97, 5.60, 6.22}},
-        },
-
-        {
-            {Artifact::StatType::kHP, {209.13, 239.00, 268.88, 298.75}},
-            {Artifact::StatType::kATK, {13.62, 15.56, 17.51, 19.45}},
-            {Artifact::StatType::kDEF, {16.20, 18.52, 20.83, 23.15}},
-            {Artifact::StatType::kHPPercent, {4.08, 4.66, 5.25, 5.83}},
-            {Artifact::StatType::kATKPercent, {4.08, 4.66, 5.25, 5.83}},
-            {Artifact::StatType::kDEFPercent, {5.10, 5.83, 6.56, 7.29}},
-            {Artifact::StatType::kElementalMastery,
-             {16.32, 18.65, 20.98, 23.31}},
-            {Artifact::StatType::kEnergyRecharge, {4.53, 5.18, 5.83, 6.48}},
-            {Artifact::StatType::kCritRate, {2.72, 3.11, 3.50, 3.89}},
-            {Artifact::StatType::kCritDMG, {5.44, 6.22, 6.99, 7.77}},
-        },
-};
-
-const int Artifact::kRarityMaxLevelList[6] = {0, 4, 4, 12, 16, 20};
-
-const std::map<std::string, std::vector<std::string>>
-    Artifact::kSetEffectDescriptionDict = {
-        {"Adventurer",
-         {"Max HP increased by 1,000.",
-          "Opening a chest regenerates 30% Max HP over 5s."}}};
+// The maximum level of different rarities
+constexpr int kRarityMaxLevelList[6] = {0, 4, 4, 12, 16, 20};
+
+static_assert(
+    LevelTable(kLevelMinArtifactEXPList[1], 0, kRarityMaxLevelList[1])
+        .CheckLookups(),
+    "The 1-Star artifact level table is inconsistent");
+static_assert(
+    LevelTable(kLevelMinArtifactEXPList[2], 0, kRarityMaxLevelList[2])
+        .CheckLookups(),
+    "The 2-Star artifact level table is inconsistent");
+static_assert(
+    LevelTable(kLevelMinArtifactEXPList[3], 0, kRarityMaxLevelList[3])
+        .CheckLookups(),
+    "The 3-Star artifact level table is inconsistent");
+static_assert(
+    LevelTable(kLevelMinArtifactEXPList[4], 0, kRarityMaxLevelList[4])
+        .CheckLookups(),
+    "The 4-Star artifact level table is inconsistent");
+static_assert(
+    LevelTable(kLevelMinArtifactEXPList[5], 0, kRarityMaxLevelList[5])
+        .CheckLookups(),
+    "The 5-Star artifact level table is inconsistent");
+
+}  // namespace
+
+const LevelTable Artifact::kLevelTableList[6] = {
+    LevelTable(kLevelMinArtifactEXPList[0], 0, kRarityMaxLevelList[0]),
+    LevelTable(kLevelMinArtifactEXPList[1], 0, kRarityMaxLevelList[1]),
+    LevelTable(kLevelMinArtifactEXPList[2], 0, kRarityMaxLevelList[2]),
+    LevelTable(kLevelMinArtifactEXPList[3], 0, kRarityMaxLevelList[3]),
+    LevelTable(kLevelMinArtifactEXPList[4], 0, kRarityMaxLevelList[4]),
+    LevelTable(kLevelMinArtifactEXPList[5], 0, kRarityMaxLevelList[5])};
+
+const Artifact::SetInfo Artifact::kSetInfoList[Artifact::kSetCount] = {
+    {"Adventurer",
+     {"Max HP increased by 1,000.",
+      "Opening a chest regenerates 30% Max HP over 5s."}}};
 
 }  // namespace genshicraft
@@ -31,12 +31,14 @@
 #ifndef GENSHICRAFT_ARTIFACT_H_
 #define GENSHICRAFT_ARTIFACT_H_
 
+#include <MC/CompoundTag.hpp>
 #include <MC/ItemStack.hpp>
-#include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "level_table.h"
 #include "stats.h"
 
 namespace genshicraft {
@@ -87,16 +89,30 @@ class Artifact {
     kCircletOfLogos
   };
 
+  inline static const int kSetCount = 1;  // the number of artifact sets
+
   /**
    * @brief The ArtifactInfo struct contains artifact information.
    *
    */
   struct ArtifactInfo {
-    std::string name;
-    std::string set_name;
+    const char *identifier;
+    const char *name;
+    int set_id;  // the index in Artifact::kSetInfoList
     Type type;
   };
 
+  /**
+   * @brief The SetInfo struct contains artifact set information.
+   *
+   */
+  struct SetInfo {
+    std::string name;
+    std::vector<std::string>
+        effect_description_list;  // the descriptions of the 2-piece set and
+                                  // the 4-piece set
+  };
+
   /**
    * @brief The StatItem struct represents a stat item.
    *
@@ -106,6 +122,32 @@ class Artifact {
     StatType type;
   };
 
+  /**
+   * @brief The View struct is a read-only snapshot of an artifact item.
+   * Making it neither writes the NBT nor applies the lore.
+   *
+   */
+  struct View {
+    int artifact_exp;           // the artifact EXP
+    int base_consumable_exp;    // the base artifact EXP as EXP material
+    const ArtifactInfo *info;   // the artifact information
+    bool is_initialized;        // false if the stats are not generated yet
+    StatItem main_stat;         // the main stat
+    int rarity;                 // the rarity (1 ~ 5)
+    StatItem sub_stat_list[4];  // the sub stats
+
+    bool operator==(const View &other) const;
+  };
+
+  /**
+   * @brief The Summary struct summarizes the artifacts equipped by a player.
+   *
+   */
+  struct Summary {
+    Stats base_stats;               // the sum of the base stats
+    int set_count_list[kSetCount];  // the artifact counts indexed by set ID
+  };
+
   Artifact() = delete;
 
   /**
@@ -197,6 +239,13 @@ class Artifact {
    */
   int GetRarity() const;
 
+  /**
+   * @brief Get the artifact set ID
+   *
+   * @return The artifact set ID
+   */
+  int GetSetID() const;
+
   /**
    * @brief Get the artifact set name
    *
@@ -226,23 +275,40 @@ class Artifact {
    */
   static bool CheckIsArtifact(ItemStack *item);
 
+  /**
+   * @brief Get the artifact ID of an identifier by the perfect hash
+   *
+   * @param identifier The identifier without the rarity suffix
+   * @return The index in the artifact information list, or -1 if the
+   * identifier is not of a GenshiCraft artifact
+   */
+  static int GetArtifactID(std::string_view identifier);
+
+  /**
+   * @brief Get the base stats of an artifact view
+   *
+   * @param view The view
+   * @return The base stats
+   */
+  static Stats GetBaseStats(const View &view);
+
   /**
    * @brief Get the number of artifacts of the set equipped by the player
    *
-   * @param set_name The set name
+   * @param set_id The set ID
    * @param playerex The PlayerEx object of the player
    * @return The number
    */
-  static int GetSetCount(const std::string &set_name, PlayerEx *playerex);
+  static int GetSetCount(int set_id, PlayerEx *playerex);
 
   /**
    * @brief Get the set effect descriptions
    *
+   * @param set_id The set ID
    * @return A list whose first element is the description of the 2-piece set
    * and the second is the description of the 4-piece set
    */
-  static std::vector<std::string> GetSetEffectDescription(
-      const std::string &set_name);
+  static const std::vector<std::string> &GetSetEffectDescription(int set_id);
 
   /**
    * @brief Make an Artifact object
@@ -255,45 +321,66 @@ class Artifact {
    */
   static std::shared_ptr<Artifact> Make(ItemStack *item, PlayerEx *playerex);
 
+  /**
+   * @brief Make a read-only view of an artifact item
+   *
+   * @param item The artifact item
+   * @return The view
+   *
+   * @exception ExceptionNotAnArtifact The item is not a GenshiCraft artifact
+   */
+  static View MakeView(ItemStack *item);
+
  private:
+  /**
+   * @brief Write the data to a tag as the "genshicraft" compound in the
+   * packed layout
+   *
+   * @param tag The "tag" compound of the item NBT
+   *
+   * @note Any legacy layout data is replaced.
+   */
+  void EncodeData(CompoundTag *tag) const;
+
   /**
    * @brief Initialize the stats
    *
    */
   void InitStats();
 
-  const static int
-      kRarityBaseConsumableEXPList[6];  // the base artifact EXP of artifacts
-                                        // with different rarities
-
-  const static std::map<std::string, ArtifactInfo>
-      kArtifactInfoDict;  // information of all artifacts
-
-  const static int
-      kLevelMinArtifactEXPList[6]
-                              [21];  // [A][B] means the minimum artifact EXP
-                                     // for A-Star artifacts to reach level B.
-
-  const static std::map<StatType, double>
-      kMainStatBase[6];  // [A][B] means the main stat of level 0 for
-                         // stat B of A-Star artifacts.
+  /**
+   * @brief Convert stat items to stats
+   *
+   * @param stat_list The stat items
+   * @param count The number of the stat items
+   * @return The stats
+   */
+  static Stats ConvertStatItems(const StatItem *stat_list, int count);
 
-  const static std::map<StatType, double>
-      kMainStatDiff[6];  // [A][B] means the main stat difference for
-                         // stat B of A-Star artifacts.
+  /**
+   * @brief Read the artifact EXP and the stats from the "genshicraft"
+   * compound in either the packed or the legacy layout
+   *
+   * @param data The "genshicraft" compound
+   * @param view The view to fill
+   */
+  static void DecodeData(CompoundTag *data, View *view);
 
-  const static std::map<StatType, std::vector<double>>
-      kPossibleSubStatDiff[6];  // [A][B] means a list of the possible B-stat
-                                // unit substat difference of A-star artifacts.
+  inline static const int kDataVersion =
+      1;  // the version of the packed NBT layout, and the legacy layout has
+          // no version
 
   const static int
-      kRarityMaxLevelList[6];  // the maximum level of different rarities
+      kRarityBaseConsumableEXPList[6];  // the base artifact EXP of artifacts
+                                        // with different rarities
+
+  const static LevelTable
+      kLevelTableList[6];  // the level tables of A-Star artifacts
 
-  const static std::map<std::string, std::vector<std::string>>
-      kSetEffectDescriptionDict;  // the set effect descriptions
+  const static SetInfo kSetInfoList[kSetCount];  // the artifact sets
 
   int artifact_exp_;
-  std::string identifier_;
+  int id_;  // the index in the artifact information list
   ItemStack *item_;
   StatItem main_stat_;
   std::vector<StatItem> sub_stat_list_;
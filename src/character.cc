@@ -36,14 +36,17 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "characters/kuki_shinobu.h"
 #include "exceptions.h"
+#include "level_table.h"
 #include "modifier.h"
 #include "playerex.h"
 #include "plugin.h"
 #include "stats.h"
+#include "world.h"
 
 namespace genshicraft {
 
@@ -52,27 +55,41 @@ const int Character::kAcensionPhaseMaxLevelList[7] = {20, 40, 50, 60,
 
 void Character::AddModifier(Modifier modifier) {
   this->modifier_list_.push_back(modifier);
+
+  this->InvalidateStats();
 }
 
 int Character::GetAscensionPhase() const { return this->ascension_phase_; }
 
 double Character::GetCDElementalBurst() const {
-  auto past_time = GetNowClock() - this->last_elemental_burst_clock_;
+  auto past_time =
+      static_cast<double>(GetNowTick() - this->last_elemental_burst_tick_) /
+      kTicksPerSecond;
   return std::max(this->GetCDElementalBurstMax() - past_time, 0.);
 };
 
 double Character::GetCDElementalSkill() const {
-  auto past_time = GetNowClock() - this->last_elemental_skill_clock_;
+  auto past_time =
+      static_cast<double>(GetNowTick() - this->last_elemental_skill_tick_) /
+      kTicksPerSecond;
   return std::max(this->GetCDElementalSkillMax() - past_time, 0.);
 };
 
 int Character::GetCharacterEXP() const { return this->character_EXP_; }
 
+int Character::GetCharacterEXPByLevel(int level) const {
+  return Character::kLevelTable.GetEXP(level);
+}
+
 int Character::GetConstellation() const { return this->constellation_; }
 
 int Character::GetEnergy() const { return this->energy_; }
 
-double Character::GetFullness() const { return this->fullness_; }
+double Character::GetFullness() const {
+  return std::max(this->fullness_ - Character::kFullnessDecayRate *
+                                        (GetNowTick() - this->fullness_tick_),
+                  0.);
+}
 
 int Character::GetHP() const { return this->HP_; }
 
@@ -81,16 +98,8 @@ int Character::GetLevel() const {
 }
 
 int Character::GetLevelByCharacterEXP(int character_exp) const {
-  int level = 1;
-
   // Get the level by the character EXP
-  for (int i = 1; i <= 90; ++i) {
-    if (Character::kLevelMinCharacterEXPList[i] <= character_exp) {
-      level = i;
-    } else {
-      break;
-    }
-  }
+  int level = Character::kLevelTable.GetLevel(character_exp);
 
   // Limit the level by the ascension phase
   level = std::min(
@@ -102,59 +111,75 @@ int Character::GetLevelByCharacterEXP(int character_exp) const {
 PlayerEx* Character::GetPlayerEx() const { return this->playerex_; }
 
 Stats Character::GetStats() const {
+  auto now_tick = GetNowTick();
+  auto hand_item = this->playerex_->GetPlayer()->getHandSlot();
+
+  if (this->is_stats_cache_valid_ &&
+      hand_item == this->stats_cache_hand_item_ &&
+      now_tick < this->stats_cache_expired_tick_) {
+    return this->stats_cache_;
+  }
+
   auto stats = this->GetBaseStats();
 
   if (this->HasWeapon()) {  // if the player is holding a GenshiCraft weapon
     stats += this->playerex_->GetWeapon()->GetBaseStats();
   }
 
-  for (auto artifact_pair: this->playerex_->GetArtifactDict()) {
-    auto artifact = artifact_pair.second;
-    stats += artifact->GetBaseStats();
-  }
+  stats += this->playerex_->GetArtifactSummary().base_stats;
 
   stats.max_stamina = this->playerex_->GetStaminaMax();
   stats.CRIT_rate += 0.05;
   stats.CRIT_DMG += 0.5;
   stats.energy_recharge += 1.;
 
+  auto expired_tick = now_tick + Character::kStatsCacheLifetime;
+
   for (const auto& modifier : this->modifier_list_) {
+    if (modifier.GetExpiredTick() < now_tick) {  // skip expired modifiers
+      continue;
+    }
+
     if (modifier.GetType() == Modifier::Type::kStats) {
       stats += modifier.GetBaseStats();
     }
+
+    // The stats change when the modifier expires
+    expired_tick = std::min(expired_tick, modifier.GetExpiredTick());
   }
 
+  this->stats_cache_ = stats;
+  this->stats_cache_expired_tick_ = expired_tick;
+  this->stats_cache_hand_item_ = hand_item;
+  this->is_stats_cache_valid_ = true;
+
   return stats;
 }
 
 std::vector<std::string> Character::GetStatsDescription(bool verbose) const {
   std::vector<std::string> description;
 
+  auto stats = this->GetStats();
+
   if (!verbose) {
-    description.push_back("Max HP: " +
-                          std::to_string(this->GetStats().GetMaxHP()));
-    description.push_back("ATK: " + std::to_string(this->GetStats().GetATK()));
-    description.push_back("DEF: " + std::to_string(this->GetStats().GetDEF()));
+    description.push_back("Max HP: " + std::to_string(stats.GetMaxHP()));
+    description.push_back("ATK: " + std::to_string(stats.GetATK()));
+    description.push_back("DEF: " + std::to_string(stats.GetDEF()));
     description.push_back("Elemental Mastery: " +
-                          std::to_string(this->GetStats().elemental_mastery));
-    description.push_back("Max Stamina: " +
-                          std::to_string(this->GetStats().max_stamina));
+                          std::to_string(stats.elemental_mastery));
+    description.push_back("Max Stamina: " + std::to_string(stats.max_stamina));
   } else {
     // Base stats
     description.push_back(
-        "Max HP: " + std::to_string(this->GetStats().max_HP_base) + " §a+" +
-        std::to_string(this->GetStats().GetMaxHP() -
-                       this->GetStats().max_HP_base));
-    description.push_back(
-        "ATK: " + std::to_string(this->GetStats().ATK_base) + " §a+" +
-        std::to_string(this->GetStats().GetATK() - this->GetStats().ATK_base));
-    description.push_back(
-        "DEF: " + std::to_string(this->GetStats().DEF_base) + " §a+" +
-        std::to_string(this->GetStats().GetDEF() - this->GetStats().DEF_base));
+        "Max HP: " + std::to_string(stats.max_HP_base) + " §a+" +
+        std::to_string(stats.GetMaxHP() - stats.max_HP_base));
+    description.push_back("ATK: " + std::to_string(stats.ATK_base) + " §a+" +
+                          std::to_string(stats.GetATK() - stats.ATK_base));
+    description.push_back("DEF: " + std::to_string(stats.DEF_base) + " §a+" +
+                          std::to_string(stats.GetDEF() - stats.DEF_base));
     description.push_back("Elemental Mastery: " +
-                          std::to_string(this->GetStats().elemental_mastery));
-    description.push_back("Max Stamina: " +
-                          std::to_string(this->GetStats().max_stamina));
+                          std::to_string(stats.elemental_mastery));
+    description.push_back("Max Stamina: " + std::to_string(stats.max_stamina));
 
     auto DoubleToString = [](double x) {
       std::ostringstream oss;
@@ -163,87 +188,42 @@ std::vector<std::string> Character::GetStatsDescription(bool verbose) const {
     };
 
     // Advanced stats
-    description.push_back(
-        "CRIT Rate: " + DoubleToString(this->GetStats().CRIT_rate * 100) +
-        "%%");
-    description.push_back(
-        "CRIT DMG: " + DoubleToString(this->GetStats().CRIT_DMG * 100) + "%%");
-    description.push_back("Healing Bonus: " +
-                          DoubleToString(this->GetStats().healing_bonus * 100) +
+    description.push_back("CRIT Rate: " +
+                          DoubleToString(stats.CRIT_rate * 100) + "%%");
+    description.push_back("CRIT DMG: " + DoubleToString(stats.CRIT_DMG * 100) +
                           "%%");
+    description.push_back("Healing Bonus: " +
+                          DoubleToString(stats.healing_bonus * 100) + "%%");
     description.push_back(
         "Incoming Healing Bonus: " +
-        DoubleToString(this->GetStats().incoming_healing_bonus * 100) + "%%");
-    description.push_back(
-        "Energy Recharge: " +
-        DoubleToString(this->GetStats().energy_recharge * 100) + "%%");
-    description.push_back(
-        "CD Reduction: " + DoubleToString(this->GetStats().CD_reduction * 100) +
-        "%%");
-    description.push_back(
-        "Shield Strength: " +
-        DoubleToString(this->GetStats().shield_strength * 100) + "%%");
+        DoubleToString(stats.incoming_healing_bonus * 100) + "%%");
+    description.push_back("Energy Recharge: " +
+                          DoubleToString(stats.energy_recharge * 100) + "%%");
+    description.push_back("CD Reduction: " +
+                          DoubleToString(stats.CD_reduction * 100) + "%%");
+    description.push_back("Shield Strength: " +
+                          DoubleToString(stats.shield_strength * 100) + "%%");
 
     // Elemental type
-    description.push_back(
-        "Pyro DMG Bonus: " +
-        DoubleToString(this->GetStats().pyro_DMG_bonus * 100) + "%%");
-    description.push_back(
-        "Pyro RES: " + DoubleToString(this->GetStats().pyro_RES * 100) + "%%");
-
-    description.push_back(
-        "Hydro DMG Bonus: " +
-        DoubleToString(this->GetStats().hydro_DMG_bonus * 100) + "%%");
-
-    description.push_back(
-        "Hydro RES: " + DoubleToString(this->GetStats().hydro_RES * 100) +
-        "%%");
-
-    description.push_back(
-        "Dendro DMG Bonus: " +
-        DoubleToString(this->GetStats().dendro_DMG_bonus * 100) + "%%");
-
-    description.push_back(
-        "Dendro RES: " + DoubleToString(this->GetStats().dendro_RES * 100) +
-        "%%");
-
-    description.push_back(
-        "Electro DMG Bonus: " +
-        DoubleToString(this->GetStats().electro_DMG_bonus * 100) + "%%");
-
-    description.push_back(
-        "Electro RES: " + DoubleToString(this->GetStats().electro_RES * 100) +
-        "%%");
-
-    description.push_back(
-        "Anemo DMG Bonus: " +
-        DoubleToString(this->GetStats().anemo_DMG_bonus * 100) + "%%");
-
-    description.push_back(
-        "Anemo RES: " + DoubleToString(this->GetStats().anemo_RES * 100) +
-        "%%");
-
-    description.push_back(
-        "Cryo DMG Bonus: " +
-        DoubleToString(this->GetStats().cryo_DMG_bonus * 100) + "%%");
-
-    description.push_back(
-        "Cryo RES: " + DoubleToString(this->GetStats().cryo_RES * 100) + "%%");
-
-    description.push_back("Geo DMG Bonus: " +
-                          DoubleToString(this->GetStats().geo_DMG_bonus * 100) +
-                          "%%");
-
-    description.push_back(
-        "Geo RES: " + DoubleToString(this->GetStats().geo_RES * 100) + "%%");
-
-    description.push_back(
-        "Physical DMG Bonus: " +
-        DoubleToString(this->GetStats().physical_DMG_bonus * 100) + "%%");
-
-    description.push_back(
-        "Physical RES: " + DoubleToString(this->GetStats().physical_RES * 100) +
-        "%%");
+    static const std::pair<world::ElementType, std::string> kElementList[8] = {
+        {world::ElementType::kPyro, "Pyro"},
+        {world::ElementType::kHydro, "Hydro"},
+        {world::ElementType::kDendro, "Dendro"},
+        {world::ElementType::kElectro, "Electro"},
+        {world::ElementType::kAnemo, "Anemo"},
+        {world::ElementType::kCryo, "Cryo"},
+        {world::ElementType::kGeo, "Geo"},
+        {world::ElementType::kPhysical, "Physical"}};
+
+    for (const auto& [element, name] : kElementList) {
+      description.push_back(
+          name + " DMG Bonus: " +
+          DoubleToString(stats.GetDMGBonus(element) * 100) + "%%");
+
+      description.push_back(name + " RES: " +
+                            DoubleToString(stats.GetRES(element) * 100) +
+                            "%%");
+    }
   }
 
   return description;
@@ -267,10 +247,14 @@ void Character::IncreaseAscensionPhase() {
           [this->ascension_phase_]) {  // if it is time to ascend
     this->ascension_phase_ = std::min(this->ascension_phase_ + 1, 6);
   }
+
+  this->InvalidateStats();
 }
 
 void Character::IncreaseCharacterEXP(int value) {
   this->character_EXP_ += std::max(value, 0);
+
+  this->InvalidateStats();
 }
 
 void Character::IncreaseConstellation() {
@@ -284,8 +268,8 @@ void Character::IncreaseEnergy(int value) {
 }
 
 void Character::IncreaseFullness(double value) {
-  this->fullness_ += value;
-  this->fullness_ = std::max(this->fullness_, 0.);
+  this->fullness_ = std::max(this->GetFullness() + value, 0.);
+  this->fullness_tick_ = GetNowTick();
 
   // When increase to full, the state keeps 30 seconds
   if (this->fullness_ > 100. && value > 0) {
@@ -315,6 +299,8 @@ void Character::IncreaseHP(int value) {
   }
 }
 
+void Character::InvalidateStats() const { this->is_stats_cache_valid_ = false; }
+
 bool Character::IsDead() const { return (this->HP_ == 0); }
 
 bool Character::IsEnergyFull() const {
@@ -323,15 +309,17 @@ bool Character::IsEnergyFull() const {
 
 void Character::Refresh() {
   // Refresh the modifiers
-  auto now_clock = GetNowClock();
+  auto now_tick = GetNowTick();
   for (auto it = this->modifier_list_.begin();
        it != this->modifier_list_.end();) {
-    if (it->GetExpiredClock() < now_clock) {
-      this->modifier_list_.erase(it);
+    if (it->GetExpiredTick() < now_tick) {
+      it = this->modifier_list_.erase(it);
     } else {
       ++it;
     }
   }
+
+  this->InvalidateStats();
 }
 
 void Character::RemoveModifier(int id) {
@@ -342,6 +330,8 @@ void Character::RemoveModifier(int id) {
       break;
     }
   }
+
+  this->InvalidateStats();
 }
 
 void Character::Revive() {
@@ -365,7 +355,10 @@ std::shared_ptr<Character> Character::Make(
   throw ExceptionNotACharacter();
 }
 
-const int Character::kLevelMinCharacterEXPList[91] = {
+namespace {
+
+// The minimum character EXP of each level
+constexpr int kLevelMinCharacterEXPList[91] = {
     0,       0,       1000,    2325,    4025,    6175,    8800,    11950,
     15675,   20025,   25025,   30725,   37175,   44400,   52450,   61375,
     71200,   81950,   93675,   106400,  120175,  135050,  151850,  169850,
@@ -379,20 +372,31 @@ const int Character::kLevelMinCharacterEXPList[91] = {
     4939525, 5122700, 5338925, 5581950, 5855050, 6161850, 6506450, 6893400,
     7327825, 7815450, 8362650};
 
+static_assert(LevelTable(kLevelMinCharacterEXPList, 1, 90).CheckLookups(),
+              "The character level table is inconsistent");
+
+}  // namespace
+
+const LevelTable Character::kLevelTable(kLevelMinCharacterEXPList, 1, 90);
+
 Character::Character(PlayerEx* playerex, int ascension_phase, int character_EXP,
                      int constellation, int energy, int HP,
                      int talent_elemental_burst_level,
                      int talent_elemental_skill_level,
                      int talent_normal_attack_level)
-    : last_elemental_burst_clock_(GetNowClock()),
-      last_elemental_skill_clock_(GetNowClock()),
+    : last_elemental_burst_tick_(GetNowTick()),
+      last_elemental_skill_tick_(GetNowTick()),
       ascension_phase_(ascension_phase),
       character_EXP_(character_EXP),
       constellation_(constellation),
       fullness_(0.),
+      fullness_tick_(GetNowTick()),
       energy_(energy),
       HP_(HP),
+      is_stats_cache_valid_(false),
       playerex_(playerex),
+      stats_cache_expired_tick_(0),
+      stats_cache_hand_item_(nullptr),
       talent_elemental_burst_level_(talent_elemental_burst_level),
       talent_elemental_skill_level_(talent_elemental_skill_level),
       talent_normal_attack_level_(talent_normal_attack_level) {
@@ -31,12 +31,14 @@
 #ifndef GENSHICRAFT_CHARACTER_H_
 #define GENSHICRAFT_CHARACTER_H_
 
+#include <MC/ItemStack.hpp>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "damage.h"
+#include "level_table.h"
 #include "modifier.h"
 #include "stats.h"
 
@@ -118,6 +120,14 @@ class Character {
    */
   int GetCharacterEXP() const;
 
+  /**
+   * @brief Get the minimum character EXP of a level
+   *
+   * @param level The level
+   * @return The minimum character EXP
+   */
+  int GetCharacterEXPByLevel(int level) const;
+
   /**
    * @brief Get the constellation
    *
@@ -164,6 +174,9 @@ class Character {
    * @brief Get the fullness
    *
    * @return The fullness
+   *
+   * @note The fullness decays linearly with ticks and is only evaluated when
+   * read or changed.
    */
   double GetFullness() const;
 
@@ -214,6 +227,9 @@ class Character {
    * @brief Get the stats
    *
    * @return The stats
+   *
+   * @note The stats are cached until Character::InvalidateStats() is called,
+   * the held item changes, a modifier expires or the cache lifetime runs out.
    */
   Stats GetStats() const;
 
@@ -294,6 +310,14 @@ class Character {
    */
   void IncreaseHP(int value);
 
+  /**
+   * @brief Invalidate the cached stats
+   *
+   * @note This method should be called whenever the equipment of the owner
+   * changes.
+   */
+  void InvalidateStats() const;
+
   /**
    * @brief Check if the character is dead
    *
@@ -377,21 +401,34 @@ class Character {
             int talent_elemental_burst_level, int talent_elemental_skill_level,
             int talent_normal_attack_level);
 
-  double last_elemental_burst_clock_;  // the clock of last elemental burst
-  double last_elemental_skill_clock_;  // the clock of last elemental skill
+  long long
+      last_elemental_burst_tick_;  // the tick of the last elemental burst
+  long long
+      last_elemental_skill_tick_;  // the tick of the last elemental skill
 
  private:
-  static const int
-      kLevelMinCharacterEXPList[91];  // the minimum character EXP of each level
+  static const LevelTable kLevelTable;  // the level table of character EXP
+  inline static const double kFullnessDecayRate =
+      0.015;  // the fullness decayed per tick
+  inline static const int kStatsCacheLifetime =
+      20;  // the lifetime of the cached stats in ticks, which covers the
+           // changes not reported by any event, e.g. those of the offhand
 
   int ascension_phase_;
   int character_EXP_;
   int constellation_;
   int energy_;
-  double fullness_;
+  double fullness_;         // the fullness at fullness_tick_
+  long long fullness_tick_;  // the tick when fullness_ was evaluated
   int HP_;
+  mutable bool is_stats_cache_valid_;  // false if the stats need recalculation
   std::vector<Modifier> modifier_list_;  // the modifiers
   PlayerEx* playerex_;
+  mutable Stats stats_cache_;  // the cached stats
+  mutable long long
+      stats_cache_expired_tick_;  // the tick when the cached stats expire
+  mutable const ItemStack*
+      stats_cache_hand_item_;  // the item held when the stats were cached
   int talent_elemental_burst_level_;
   int talent_elemental_skill_level_;
   int talent_normal_attack_level_;
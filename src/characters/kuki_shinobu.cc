@@ -83,7 +83,7 @@ double KukiShinobu::GetCDElementalSkillMax() const { return 15.; };
 
 Damage KukiShinobu::GetDamageElementalBurst() {
   if (this->GetCDElementalBurst() < 0.0001 && this->IsEnergyFull()) {
-    this->last_elemental_burst_clock_ = GetNowClock();
+    this->last_elemental_burst_tick_ = GetNowTick();
     this->IncreaseEnergy(-60);
     return Damage();
   }
@@ -92,7 +92,7 @@ Damage KukiShinobu::GetDamageElementalBurst() {
 
 Damage KukiShinobu::GetDamageElementalSkill() {
   if (this->GetCDElementalSkill() < 0.0001) {
-    this->last_elemental_skill_clock_ = GetNowClock();
+    this->last_elemental_skill_tick_ = GetNowTick();
     return Damage();
   }
   return Damage();
@@ -100,7 +100,7 @@ Damage KukiShinobu::GetDamageElementalSkill() {
 
 Damage KukiShinobu::GetDamageNormalAttack() {
   static int hit_count = 1;
-  static auto last_hit_clock = GetNowClock();
+  static auto last_hit_tick = GetNowTick();
 
   Damage damage;
 
@@ -122,7 +122,7 @@ Damage KukiShinobu::GetDamageNormalAttack() {
   } else {  // normal attack
 
     // Reset hit count if not attacking in 5s
-    if (GetNowClock() - last_hit_clock > 5) {
+    if (GetNowTick() - last_hit_tick > 5 * kTicksPerSecond) {
       hit_count = 1;
     }
 
@@ -135,7 +135,7 @@ Damage KukiShinobu::GetDamageNormalAttack() {
       hit_count = 1;
     }
 
-    last_hit_clock = GetNowClock();
+    last_hit_tick = GetNowTick();
   }
 
   damage.SetAttackElementType(world::ElementType::kPhysical);
@@ -153,8 +153,8 @@ std::string KukiShinobu::GetName() const { return "Kuki Shinobu"; }
 int KukiShinobu::GetRarity() const { return 4; }
 
 bool KukiShinobu::HasWeapon() const {
-  if (this->GetPlayerEx()->GetWeapon() &&
-      this->GetPlayerEx()->GetWeapon()->GetType() == Weapon::Type::kSword) {
+  auto weapon = this->GetPlayerEx()->GetWeapon();
+  if (weapon && weapon->GetType() == Weapon::Type::kSword) {
     return true;
   } else {
     return false;
@@ -35,10 +35,14 @@
 #include <MC/CommandOrigin.hpp>
 #include <MC/CommandOutput.hpp>
 #include <MC/ServerPlayer.hpp>
+#include <algorithm>
+#include <string>
 #include <unordered_map>
 
 #include "menu.h"
 #include "playerex.h"
+#include "profiler.h"
+#include "sidebar.h"
 
 namespace genshicraft {
 
@@ -55,6 +59,46 @@ void Command::Init() {
         auto playerex = PlayerEx::Get(xuid);
         playerex->GetMenu().OpenMain();
       });
+
+  DynamicCommand::setup(
+      "gcperf", "Show GenshiCraft performance statistics", {},
+      {
+          DynamicCommand::ParameterData(
+              "dump_interval", DynamicCommand::ParameterType::Int, true),
+      },
+      {
+          {"dump_interval"},
+      },
+      [](DynamicCommand const& command, CommandOrigin const& origin,
+         CommandOutput& output,
+         std::unordered_map<std::string, DynamicCommand::Result>& results) {
+        if (results["dump_interval"].isSet) {
+          profiler::SetDumpInterval(results["dump_interval"].get<int>());
+        }
+
+        int sidebar_packet_rate_sum = 0;
+        int sidebar_packet_rate_max = 0;
+        for (const auto& playerex : PlayerEx::GetAll()) {
+          auto packet_rate = playerex->GetSidebar().GetPacketRate();
+          sidebar_packet_rate_sum += packet_rate;
+          sidebar_packet_rate_max =
+              std::max(sidebar_packet_rate_max, packet_rate);
+        }
+
+        std::string message =
+            "Inventory resyncs saved: " +
+            std::to_string(PlayerEx::GetSavedItemsRefreshCount()) +
+            "\nUpkeep jobs deferred: " +
+            std::to_string(PlayerEx::GetDeferredTickJobCount()) +
+            "\nSidebar packets per second: " +
+            std::to_string(sidebar_packet_rate_sum) + " in total, " +
+            std::to_string(sidebar_packet_rate_max) + " at most per player";
+        for (const auto& line : profiler::GetReport()) {
+          message += "\n" + line;
+        }
+        output.success(message);
+      },
+      CommandPermissionLevel::GameMasters);
 }
 
 }  // namespace genshicraft
@@ -41,6 +41,273 @@
 
 namespace genshicraft {
 
+namespace {
+
+// The group of each reaction type, indexed by world::ElementalReactionType
+constexpr world::ElementalReactionGroup kElementalReactionGroupList[13] = {
+    world::ElementalReactionGroup::kNone,  // kNone
+    world::ElementalReactionGroup::kNone,  // kBloom
+    world::ElementalReactionGroup::kNone,  // kBurning
+    world::ElementalReactionGroup::kNone,  // kCatalyze
+    world::ElementalReactionGroup::kNone,  // kCrystallize
+    world::ElementalReactionGroup::kTransformative,  // kElectroCharged
+    world::ElementalReactionGroup::kNone,  // kFrozen
+    world::ElementalReactionGroup::kAmplifying,  // kMelt
+    world::ElementalReactionGroup::kTransformative,  // kOverloaded
+    world::ElementalReactionGroup::kTransformative,  // kShattered
+    world::ElementalReactionGroup::kTransformative,  // kSuperconduct
+    world::ElementalReactionGroup::kTransformative,  // kSwirl
+    world::ElementalReactionGroup::kAmplifying,  // kVaporize
+};
+
+// The reaction type indexed by the attack element and the element attached to
+// the victim
+constexpr world::ElementalReactionType kElementalReactionTypeList[8][8] = {
+    // Physical attack
+    {
+        world::ElementalReactionType::kNone,  // Physical victim
+        world::ElementalReactionType::kNone,  // Anemo victim
+        world::ElementalReactionType::kNone,  // Cryo victim
+        world::ElementalReactionType::kNone,  // Dendro victim
+        world::ElementalReactionType::kNone,  // Electro victim
+        world::ElementalReactionType::kNone,  // Geo victim
+        world::ElementalReactionType::kNone,  // Hydro victim
+        world::ElementalReactionType::kNone,  // Pyro victim
+    },
+    // Anemo attack
+    {
+        world::ElementalReactionType::kNone,  // Physical victim
+        world::ElementalReactionType::kNone,  // Anemo victim
+        world::ElementalReactionType::kSwirl,  // Cryo victim
+        world::ElementalReactionType::kNone,  // Dendro victim
+        world::ElementalReactionType::kSwirl,  // Electro victim
+        world::ElementalReactionType::kNone,  // Geo victim
+        world::ElementalReactionType::kSwirl,  // Hydro victim
+        world::ElementalReactionType::kSwirl,  // Pyro victim
+    },
+    // Cryo attack
+    {
+        world::ElementalReactionType::kNone,  // Physical victim
+        world::ElementalReactionType::kNone,  // Anemo victim
+        world::ElementalReactionType::kNone,  // Cryo victim
+        world::ElementalReactionType::kNone,  // Dendro victim
+        world::ElementalReactionType::kSuperconduct,  // Electro victim
+        world::ElementalReactionType::kNone,  // Geo victim
+        world::ElementalReactionType::kFrozen,  // Hydro victim
+        world::ElementalReactionType::kMelt,  // Pyro victim
+    },
+    // Dendro attack
+    {
+        world::ElementalReactionType::kNone,  // Physical victim
+        world::ElementalReactionType::kNone,  // Anemo victim
+        world::ElementalReactionType::kNone,  // Cryo victim
+        world::ElementalReactionType::kNone,  // Dendro victim
+        world::ElementalReactionType::kCatalyze,  // Electro victim
+        world::ElementalReactionType::kNone,  // Geo victim
+        world::ElementalReactionType::kBloom,  // Hydro victim
+        world::ElementalReactionType::kBurning,  // Pyro victim
+    },
+    // Electro attack
+    {
+        world::ElementalReactionType::kNone,  // Physical victim
+        world::ElementalReactionType::kNone,  // Anemo victim
+        world::ElementalReactionType::kSuperconduct,  // Cryo victim
+        world::ElementalReactionType::kCatalyze,  // Dendro victim
+        world::ElementalReactionType::kNone,  // Electro victim
+        world::ElementalReactionType::kNone,  // Geo victim
+        world::ElementalReactionType::kElectroCharged,  // Hydro victim
+        world::ElementalReactionType::kOverloaded,  // Pyro victim
+    },
+    // Geo attack
+    {
+        world::ElementalReactionType::kNone,  // Physical victim
+        world::ElementalReactionType::kNone,  // Anemo victim
+        world::ElementalReactionType::kCrystallize,  // Cryo victim
+        world::ElementalReactionType::kNone,  // Dendro victim
+        world::ElementalReactionType::kCrystallize,  // Electro victim
+        world::ElementalReactionType::kNone,  // Geo victim
+        world::ElementalReactionType::kCrystallize,  // Hydro victim
+        world::ElementalReactionType::kCrystallize,  // Pyro victim
+    },
+    // Hydro attack
+    {
+        world::ElementalReactionType::kNone,  // Physical victim
+        world::ElementalReactionType::kNone,  // Anemo victim
+        world::ElementalReactionType::kFrozen,  // Cryo victim
+        world::ElementalReactionType::kBloom,  // Dendro victim
+        world::ElementalReactionType::kElectroCharged,  // Electro victim
+        world::ElementalReactionType::kNone,  // Geo victim
+        world::ElementalReactionType::kNone,  // Hydro victim
+        world::ElementalReactionType::kVaporize,  // Pyro victim
+    },
+    // Pyro attack
+    {
+        world::ElementalReactionType::kNone,  // Physical victim
+        world::ElementalReactionType::kNone,  // Anemo victim
+        world::ElementalReactionType::kMelt,  // Cryo victim
+        world::ElementalReactionType::kBurning,  // Dendro victim
+        world::ElementalReactionType::kOverloaded,  // Electro victim
+        world::ElementalReactionType::kNone,  // Geo victim
+        world::ElementalReactionType::kVaporize,  // Hydro victim
+        world::ElementalReactionType::kNone,  // Pyro victim
+    },
+};
+
+/**
+ * @brief Get the reaction type by the if-else chain the tables replaced
+ *
+ * @param attack_element The attack element
+ * @param victim_element The element attached to the victim
+ * @return The reaction type
+ *
+ * @note This is kept only as the reference for the tables. The reversed
+ * branches of crystallize and swirl compare the victim element with itself, as
+ * the original chain did.
+ */
+constexpr world::ElementalReactionType GetElementalReactionTypeByChain(
+    world::ElementType attack_element, world::ElementType victim_element) {
+  if ((attack_element == world::ElementType::kDendro &&
+       victim_element == world::ElementType::kHydro) ||
+      (victim_element == world::ElementType::kDendro &&
+       attack_element == world::ElementType::kHydro)) {
+    return world::ElementalReactionType::kBloom;
+
+  } else if ((attack_element == world::ElementType::kDendro &&
+              victim_element == world::ElementType::kPyro) ||
+             (victim_element == world::ElementType::kDendro &&
+              attack_element == world::ElementType::kPyro)) {
+    return world::ElementalReactionType::kBurning;
+
+  } else if ((attack_element == world::ElementType::kDendro &&
+              victim_element == world::ElementType::kElectro) ||
+             (victim_element == world::ElementType::kDendro &&
+              attack_element == world::ElementType::kElectro)) {
+    return world::ElementalReactionType::kCatalyze;
+
+  } else if ((attack_element == world::ElementType::kGeo &&
+              (victim_element == world::ElementType::kCryo ||
+               victim_element == world::ElementType::kElectro ||
+               victim_element == world::ElementType::kHydro ||
+               victim_element == world::ElementType::kPyro)) ||
+             ((victim_element == world::ElementType::kCryo ||
+               victim_element == world::ElementType::kElectro ||
+               victim_element == world::ElementType::kHydro ||
+               victim_element == world::ElementType::kPyro) &&
+              victim_element == world::ElementType::kGeo)) {
+    return world::ElementalReactionType::kCrystallize;
+
+  } else if ((attack_element == world::ElementType::kElectro &&
+              victim_element == world::ElementType::kHydro) ||
+             (victim_element == world::ElementType::kElectro &&
+              attack_element == world::ElementType::kHydro)) {
+    return world::ElementalReactionType::kElectroCharged;
+
+  } else if ((attack_element == world::ElementType::kCryo &&
+              victim_element == world::ElementType::kHydro) ||
+             (victim_element == world::ElementType::kCryo &&
+              attack_element == world::ElementType::kHydro)) {
+    return world::ElementalReactionType::kFrozen;
+
+  } else if ((attack_element == world::ElementType::kCryo &&
+              victim_element == world::ElementType::kPyro) ||
+             (victim_element == world::ElementType::kCryo &&
+              attack_element == world::ElementType::kPyro)) {
+    return world::ElementalReactionType::kMelt;
+
+  } else if ((attack_element == world::ElementType::kElectro &&
+              victim_element == world::ElementType::kPyro) ||
+             (victim_element == world::ElementType::kElectro &&
+              attack_element == world::ElementType::kPyro)) {
+    return world::ElementalReactionType::kOverloaded;
+
+  } else if ((attack_element == world::ElementType::kCryo &&
+              victim_element == world::ElementType::kElectro) ||
+             (victim_element == world::ElementType::kCryo &&
+              attack_element == world::ElementType::kElectro)) {
+    return world::ElementalReactionType::kSuperconduct;
+
+  } else if ((attack_element == world::ElementType::kAnemo &&
+              (victim_element == world::ElementType::kCryo ||
+               victim_element == world::ElementType::kElectro ||
+               victim_element == world::ElementType::kHydro ||
+               victim_element == world::ElementType::kPyro)) ||
+             ((victim_element == world::ElementType::kCryo ||
+               victim_element == world::ElementType::kElectro ||
+               victim_element == world::ElementType::kHydro ||
+               victim_element == world::ElementType::kPyro) &&
+              victim_element == world::ElementType::kAnemo)) {
+    return world::ElementalReactionType::kSwirl;
+
+  } else if ((attack_element == world::ElementType::kHydro &&
+              victim_element == world::ElementType::kPyro) ||
+             (victim_element == world::ElementType::kHydro &&
+              attack_element == world::ElementType::kPyro)) {
+    return world::ElementalReactionType::kVaporize;
+
+  } else {
+    return world::ElementalReactionType::kNone;
+  }
+}
+
+/**
+ * @brief Get the reaction group by the if-else chain the table replaced
+ *
+ * @param reaction_type The reaction type
+ * @return The reaction group
+ *
+ * @note This is kept only as the reference for the table.
+ */
+constexpr world::ElementalReactionGroup GetElementalReactionGroupByChain(
+    world::ElementalReactionType reaction_type) {
+  if (reaction_type == world::ElementalReactionType::kElectroCharged ||
+      reaction_type == world::ElementalReactionType::kOverloaded ||
+      reaction_type == world::ElementalReactionType::kShattered ||
+      reaction_type == world::ElementalReactionType::kSuperconduct ||
+      reaction_type == world::ElementalReactionType::kSwirl) {
+    return world::ElementalReactionGroup::kTransformative;
+  }
+
+  if (reaction_type == world::ElementalReactionType::kMelt ||
+      reaction_type == world::ElementalReactionType::kVaporize) {
+    return world::ElementalReactionGroup::kAmplifying;
+  }
+
+  return world::ElementalReactionGroup::kNone;
+}
+
+/**
+ * @brief Check the tables against the if-else chains for all element pairs
+ * and all reaction types
+ *
+ * @return True if the tables agree with the chains
+ */
+constexpr bool CheckElementalReactionTables() {
+  for (int i = 0; i < 8; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      if (kElementalReactionTypeList[i][j] !=
+          GetElementalReactionTypeByChain(static_cast<world::ElementType>(i),
+                                          static_cast<world::ElementType>(j))) {
+        return false;
+      }
+    }
+  }
+
+  for (int i = 0; i < 13; ++i) {
+    if (kElementalReactionGroupList[i] !=
+        GetElementalReactionGroupByChain(
+            static_cast<world::ElementalReactionType>(i))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static_assert(CheckElementalReactionTables(),
+              "The elemental reaction tables must match the if-else chains");
+
+}  // namespace
+
 Damage::Damage()
     : source_type_(Damage::SourceType::kMob),
 
@@ -80,56 +347,17 @@ double Damage::Get() const {
   // Normal damage
   double damage = 0.;
 
-  if (this->GetElementalReactionGroup() ==
-          world::ElementalReactionGroup::kNone ||
-      this->GetElementalReactionGroup() ==
-          world::ElementalReactionGroup::kAmplifying ||
-      this->GetElementalReactionGroup() ==
-          world::ElementalReactionGroup::kTransformative) {
+  auto reaction_group = this->GetElementalReactionGroup();
+
+  if (reaction_group == world::ElementalReactionGroup::kNone ||
+      reaction_group == world::ElementalReactionGroup::kAmplifying ||
+      reaction_group == world::ElementalReactionGroup::kTransformative) {
     // Base damage
     damage = this->attacker_stats_.GetATK() * this->attacker_amplifier_;
 
     // Damage bonus
-    double damage_bonus = 1.;
-
-    switch (this->attack_element_) {
-      case world::ElementType::kPyro:
-        damage_bonus += this->attacker_stats_.pyro_DMG_bonus;
-        break;
-
-      case world::ElementType::kHydro:
-        damage_bonus += this->attacker_stats_.hydro_DMG_bonus;
-        break;
-
-      case world::ElementType::kDendro:
-        damage_bonus += this->attacker_stats_.dendro_DMG_bonus;
-        break;
-
-      case world::ElementType::kElectro:
-        damage_bonus += this->attacker_stats_.electro_DMG_bonus;
-        break;
-
-      case world::ElementType::kAnemo:
-        damage_bonus += this->attacker_stats_.anemo_DMG_bonus;
-        break;
-
-      case world::ElementType::kCryo:
-        damage_bonus += this->attacker_stats_.cryo_DMG_bonus;
-        break;
-
-      case world::ElementType::kGeo:
-        damage_bonus += this->attacker_stats_.geo_DMG_bonus;
-        break;
-
-      case world::ElementType::kPhysical:
-        damage_bonus += this->attacker_stats_.physical_DMG_bonus;
-        break;
-
-      default:
-        break;
-    }
-
-    damage *= damage_bonus;
+    damage *= 1. + this->attacker_stats_
+                       .DMG_bonus[static_cast<int>(this->attack_element_)];
 
     // Critical hit
     if (dist(random_engine) < this->attacker_stats_.CRIT_rate) {
@@ -142,8 +370,7 @@ double Damage::Get() const {
         ((this->attacker_level_ + 100) * 5. + this->victim_stats_.GetDEF());
   }
 
-  if (this->GetElementalReactionGroup() ==
-      world::ElementalReactionGroup::kAmplifying) {
+  if (reaction_group == world::ElementalReactionGroup::kAmplifying) {
     // Amplifying reactions
     double reaction_bonus = 1.;
 
@@ -167,7 +394,7 @@ double Damage::Get() const {
     damage *= reaction_bonus;
   }
 
-  if (this->GetElementalReactionGroup() ==
+  if (reaction_group ==
       world::ElementalReactionGroup::kTransformativeSecondary) {
     // Level multiplier
     damage =
@@ -185,43 +412,8 @@ double Damage::Get() const {
   }
 
   // Resistance
-  double RES = 0.;
-  switch (this->GetElementType()) {
-    case world::ElementType::kPyro:
-      RES += this->victim_stats_.pyro_RES;
-      break;
-
-    case world::ElementType::kHydro:
-      RES += this->victim_stats_.hydro_RES;
-      break;
-
-    case world::ElementType::kDendro:
-      RES += this->victim_stats_.dendro_RES;
-      break;
-
-    case world::ElementType::kElectro:
-      RES += this->victim_stats_.electro_RES;
-      break;
-
-    case world::ElementType::kAnemo:
-      RES += this->victim_stats_.anemo_RES;
-      break;
-
-    case world::ElementType::kCryo:
-      RES += this->victim_stats_.cryo_RES;
-      break;
-
-    case world::ElementType::kGeo:
-      RES += this->victim_stats_.geo_RES;
-      break;
-
-    case world::ElementType::kPhysical:
-      RES += this->victim_stats_.physical_RES;
-      break;
-
-    default:
-      break;
-  }
+  double RES =
+      this->victim_stats_.RES[static_cast<int>(this->GetElementType())];
 
   if (RES < 0.) {
     damage *= 1. - RES / 2;
@@ -245,22 +437,8 @@ world::ElementalReactionGroup Damage::GetElementalReactionGroup() const {
     return world::ElementalReactionGroup::kTransformativeSecondary;
   }
 
-  auto reaction_type = this->GetElementalReactionType();
-
-  if (reaction_type == world::ElementalReactionType::kElectroCharged ||
-      reaction_type == world::ElementalReactionType::kOverloaded ||
-      reaction_type == world::ElementalReactionType::kShattered ||
-      reaction_type == world::ElementalReactionType::kSuperconduct ||
-      reaction_type == world::ElementalReactionType::kSwirl) {
-    return world::ElementalReactionGroup::kTransformative;
-  }
-
-  if (reaction_type == world::ElementalReactionType::kMelt ||
-      reaction_type == world::ElementalReactionType::kVaporize) {
-    return world::ElementalReactionGroup::kAmplifying;
-  }
-
-  return world::ElementalReactionGroup::kNone;
+  return kElementalReactionGroupList[static_cast<int>(
+      this->GetElementalReactionType())];
 }
 
 world::ElementalReactionType Damage::GetElementalReactionType() const {
@@ -272,87 +450,8 @@ world::ElementalReactionType Damage::GetElementalReactionType() const {
     return world::ElementalReactionType::kNone;
   }
 
-  if ((this->attack_element_ == world::ElementType::kDendro &&
-       this->victim_element_ == world::ElementType::kHydro) ||
-      (this->victim_element_ == world::ElementType::kDendro &&
-       this->attack_element_ == world::ElementType::kHydro)) {
-    return world::ElementalReactionType::kBloom;
-
-  } else if ((this->attack_element_ == world::ElementType::kDendro &&
-              this->victim_element_ == world::ElementType::kPyro) ||
-             (this->victim_element_ == world::ElementType::kDendro &&
-              this->attack_element_ == world::ElementType::kPyro)) {
-    return world::ElementalReactionType::kBurning;
-
-  } else if ((this->attack_element_ == world::ElementType::kDendro &&
-              this->victim_element_ == world::ElementType::kElectro) ||
-             (this->victim_element_ == world::ElementType::kDendro &&
-              this->attack_element_ == world::ElementType::kElectro)) {
-    return world::ElementalReactionType::kCatalyze;
-
-  } else if ((this->attack_element_ == world::ElementType::kGeo &&
-              (this->victim_element_ == world::ElementType::kCryo ||
-               this->victim_element_ == world::ElementType::kElectro ||
-               this->victim_element_ == world::ElementType::kHydro ||
-               this->victim_element_ == world::ElementType::kPyro)) ||
-             ((this->victim_element_ == world::ElementType::kCryo ||
-               this->victim_element_ == world::ElementType::kElectro ||
-               this->victim_element_ == world::ElementType::kHydro ||
-               this->victim_element_ == world::ElementType::kPyro) &&
-              this->victim_element_ == world::ElementType::kGeo)) {
-    return world::ElementalReactionType::kCrystallize;
-
-  } else if ((this->attack_element_ == world::ElementType::kElectro &&
-              this->victim_element_ == world::ElementType::kHydro) ||
-             (this->victim_element_ == world::ElementType::kElectro &&
-              this->attack_element_ == world::ElementType::kHydro)) {
-    return world::ElementalReactionType::kElectroCharged;
-
-  } else if ((this->attack_element_ == world::ElementType::kCryo &&
-              this->victim_element_ == world::ElementType::kHydro) ||
-             (this->victim_element_ == world::ElementType::kCryo &&
-              this->attack_element_ == world::ElementType::kHydro)) {
-    return world::ElementalReactionType::kFrozen;
-
-  } else if ((this->attack_element_ == world::ElementType::kCryo &&
-              this->victim_element_ == world::ElementType::kPyro) ||
-             (this->victim_element_ == world::ElementType::kCryo &&
-              this->attack_element_ == world::ElementType::kPyro)) {
-    return world::ElementalReactionType::kMelt;
-
-  } else if ((this->attack_element_ == world::ElementType::kElectro &&
-              this->victim_element_ == world::ElementType::kPyro) ||
-             (this->victim_element_ == world::ElementType::kElectro &&
-              this->attack_element_ == world::ElementType::kPyro)) {
-    return world::ElementalReactionType::kOverloaded;
-
-  } else if ((this->attack_element_ == world::ElementType::kCryo &&
-              this->victim_element_ == world::ElementType::kElectro) ||
-             (this->victim_element_ == world::ElementType::kCryo &&
-              this->attack_element_ == world::ElementType::kElectro)) {
-    return world::ElementalReactionType::kSuperconduct;
-
-  } else if ((this->attack_element_ == world::ElementType::kAnemo &&
-              (this->victim_element_ == world::ElementType::kCryo ||
-               this->victim_element_ == world::ElementType::kElectro ||
-               this->victim_element_ == world::ElementType::kHydro ||
-               this->victim_element_ == world::ElementType::kPyro)) ||
-             ((this->victim_element_ == world::ElementType::kCryo ||
-               this->victim_element_ == world::ElementType::kElectro ||
-               this->victim_element_ == world::ElementType::kHydro ||
-               this->victim_element_ == world::ElementType::kPyro) &&
-              this->victim_element_ == world::ElementType::kAnemo)) {
-    return world::ElementalReactionType::kSwirl;
-
-  } else if ((this->attack_element_ == world::ElementType::kHydro &&
-              this->victim_element_ == world::ElementType::kPyro) ||
-             (this->victim_element_ == world::ElementType::kHydro &&
-              this->attack_element_ == world::ElementType::kPyro)) {
-    return world::ElementalReactionType::kVaporize;
-
-  } else {
-    return world::ElementalReactionType::kNone;
-  }
+  return kElementalReactionTypeList[static_cast<int>(
+      this->attack_element_)][static_cast<int>(this->victim_element_)];
 }
 
 world::ElementType Damage::GetElementType() const {
@@ -379,7 +478,9 @@ Damage Damage::GetSecondaryDamage() const {
 
   damage.source_type_ = this->source_type_;
 
-  switch (this->GetElementalReactionType()) {
+  auto reaction_type = this->GetElementalReactionType();
+
+  switch (reaction_type) {
     case world::ElementalReactionType::kElectroCharged:
       damage.attack_element_ = world::ElementType::kElectro;
       break;
@@ -405,9 +506,9 @@ Damage Damage::GetSecondaryDamage() const {
   }
 
   damage.is_secondary_ = true;
-  damage.is_secondary_swirl_ = (this->GetElementalReactionType() ==
-                                world::ElementalReactionType::kSwirl);
-  damage.secondary_reaction_type_ = this->GetElementalReactionType();
+  damage.is_secondary_swirl_ =
+      (reaction_type == world::ElementalReactionType::kSwirl);
+  damage.secondary_reaction_type_ = reaction_type;
 
   damage.attacker_amplifier_ = this->attacker_amplifier_;
   damage.attacker_level_ = this->attacker_level_;
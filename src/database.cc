@@ -0,0 +1,173 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file database.cc
+ * @author Futrime (futrime@outlook.com)
+ * @brief Definition of the database interfaces
+ * @version 1.0.0
+ * @date 2022-08-18
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#include "database.h"
+
+#include <KVDBAPI.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <third-party/Nlohmann/json.hpp>
+#include <thread>
+#include <unordered_map>
+
+#include "plugin.h"
+
+namespace genshicraft {
+
+namespace database {
+
+namespace {
+
+const std::chrono::seconds kFlushInterval(
+    5);  // the interval between two flushes of the background writer
+
+std::condition_variable condition_variable;  // notifies the background writer
+                                             // and the closer
+bool is_writer_running = false;  // true if the background writer is running
+std::mutex mutex;                // guards all variables below and the writer
+std::unordered_map<std::string, nlohmann::json>
+    pending_player_data_dict;  // the player data pending to write
+std::unique_ptr<KVDB> players_db;  // the database of players
+bool should_writer_stop = false;   // true if the background writer should stop
+std::unordered_map<std::string, nlohmann::json>
+    writing_player_data_dict;  // the player data being written
+
+/**
+ * @brief Write the player data to the database
+ *
+ * @param xuid The XUID of the player
+ * @param data The data of the player
+ */
+void WritePlayerData(const std::string& xuid, const nlohmann::json& data) {
+  if (!players_db->set(xuid, data.dump())) {
+    logger.error("Failed to save the data of player {}.", xuid);
+  }
+}
+
+/**
+ * @brief The main loop of the background writer
+ *
+ */
+void RunWriter() {
+  std::unique_lock<std::mutex> lock(mutex);
+
+  while (true) {
+    condition_variable.wait_for(lock, kFlushInterval, [] {
+      return should_writer_stop;
+    });
+
+    // Take all pending data at once so that new data can be set while writing
+    writing_player_data_dict.swap(pending_player_data_dict);
+
+    lock.unlock();
+    for (const auto& [xuid, data] : writing_player_data_dict) {
+      WritePlayerData(xuid, data);
+    }
+    lock.lock();
+
+    writing_player_data_dict.clear();
+
+    if (should_writer_stop && pending_player_data_dict.empty()) {
+      break;
+    }
+  }
+
+  is_writer_running = false;
+  condition_variable.notify_all();
+}
+
+}  // namespace
+
+void Close() {
+  std::unique_lock<std::mutex> lock(mutex);
+
+  should_writer_stop = true;
+  condition_variable.notify_all();
+
+  // Wait for the background writer to write all pending data
+  condition_variable.wait(lock, [] { return !is_writer_running; });
+}
+
+nlohmann::json GetPlayerData(const std::string& xuid) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // The data pending to write is newer than that being written, which is
+    // newer than that in the database
+    auto iter = pending_player_data_dict.find(xuid);
+    if (iter != pending_player_data_dict.end()) {
+      return iter->second;
+    }
+
+    iter = writing_player_data_dict.find(xuid);
+    if (iter != writing_player_data_dict.end()) {
+      return iter->second;
+    }
+  }
+
+  std::string data_str;
+  if (!players_db->get(xuid, data_str)) {
+    return nlohmann::json();
+  }
+
+  try {
+    return nlohmann::json::parse(data_str);
+  } catch (const nlohmann::json::parse_error&) {
+    return nlohmann::json();
+  }
+}
+
+void Init() {
+  players_db = KVDB::open("plugins/GenshiCraft/db/players");
+
+  is_writer_running = true;
+  std::thread(RunWriter).detach();  // the writer notifies database::Close()
+                                    // when it stops, so it is not joined
+}
+
+void SetPlayerData(const std::string& xuid, nlohmann::json data) {
+  std::unique_lock<std::mutex> lock(mutex);
+
+  // Write synchronously if the background writer has stopped
+  if (!is_writer_running) {
+    WritePlayerData(xuid, data);
+    return;
+  }
+
+  pending_player_data_dict[xuid] = std::move(data);
+}
+
+}  // namespace database
+
+}  // namespace genshicraft
@@ -0,0 +1,81 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file database.h
+ * @author Futrime (futrime@outlook.com)
+ * @brief Declaration of the database interfaces
+ * @version 1.0.0
+ * @date 2022-08-18
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#ifndef GENSHICRAFT_DATABASE_H_
+#define GENSHICRAFT_DATABASE_H_
+
+#include <string>
+#include <third-party/Nlohmann/json.hpp>
+
+namespace genshicraft {
+
+namespace database {
+
+/**
+ * @brief Write all pending data and stop the background writer
+ *
+ * @note After this function is called, data will be written synchronously.
+ */
+void Close();
+
+/**
+ * @brief Get the data of a player
+ *
+ * @param xuid The XUID of the player
+ * @return The data of the player
+ *
+ * @note This function returns the data pending to write if any, so the data
+ * set by database::SetPlayerData() is always visible. If no data is found, an
+ * empty JSON object will be returned.
+ */
+nlohmann::json GetPlayerData(const std::string& xuid);
+
+/**
+ * @brief Initialize the database and start the background writer
+ *
+ */
+void Init();
+
+/**
+ * @brief Set the data of a player
+ *
+ * @param xuid The XUID of the player
+ * @param data The data of the player
+ *
+ * @note The data is serialized and written by the background writer. If the
+ * data of the player is already pending to write, it will be replaced.
+ */
+void SetPlayerData(const std::string& xuid, nlohmann::json data);
+
+}  // namespace database
+
+}  // namespace genshicraft
+
+#endif  // GENSHICRAFT_DATABASE_H_
@@ -37,6 +37,7 @@
 
 #include "character.h"
 #include "exceptions.h"
+#include "item.h"
 #include "playerex.h"
 #include "plugin.h"
 
@@ -49,11 +50,7 @@ const std::map<std::string, std::string> kFoodDescriptionDict = {
     {"genshicraft:sunsettia", "Restores §l300§r HP."}};
 
 bool CheckIsFood(ItemStack* item) {
-  if (kFoodDescriptionDict.count(item->getTypeName()) == 1) {
-    return true;
-  } else {
-    return false;
-  }
+  return item::Classify(item).kind == item::Kind::kFood;
 }
 
 bool EatFood(PlayerEx* playerex, ItemStack* food) {
@@ -0,0 +1,104 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file item.cc
+ * @author Futrime (futrime@outlook.com)
+ * @brief Definition of the item classifier
+ * @version 1.0.0
+ * @date 2022-08-23
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#include "item.h"
+
+#include <MC/ItemStack.hpp>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "artifact.h"
+#include "food.h"
+#include "weapon.h"
+
+namespace genshicraft {
+
+namespace item {
+
+namespace {
+
+std::unordered_map<short, Classification>
+    classification_cache;  // the classifications by the native item IDs
+
+/**
+ * @brief Classify an item by its type name
+ *
+ * @param type_name The type name
+ * @return The classification
+ */
+Classification ClassifyTypeName(const std::string& type_name) {
+  // Artifacts are named as <identifier>_<rarity>
+  if (type_name.size() >= 2) {
+    auto artifact_id = Artifact::GetArtifactID(
+        std::string_view(type_name).substr(0, type_name.size() - 2));
+    if (artifact_id != -1) {
+      auto rarity = type_name.back() - '0';
+      return {Kind::kArtifact, artifact_id, std::clamp(rarity, 1, 5)};
+    }
+  }
+
+  auto weapon_id = Weapon::GetWeaponID(type_name);
+  if (weapon_id != -1) {
+    return {Kind::kWeapon, weapon_id, 0};
+  }
+
+  auto food_it = food::kFoodDescriptionDict.find(type_name);
+  if (food_it != food::kFoodDescriptionDict.end()) {
+    return {Kind::kFood,
+            static_cast<int>(
+                std::distance(food::kFoodDescriptionDict.begin(), food_it)),
+            0};
+  }
+
+  return {Kind::kNone, -1, 0};
+}
+
+}  // namespace
+
+Classification Classify(ItemStack* item) {
+  // The native item IDs are fixed while the server is running
+  auto native_id = item->getId();
+
+  auto it = classification_cache.find(native_id);
+  if (it != classification_cache.end()) {
+    return it->second;
+  }
+
+  auto classification = ClassifyTypeName(item->getTypeName());
+  classification_cache[native_id] = classification;
+  return classification;
+}
+
+}  // namespace item
+
+}  // namespace genshicraft
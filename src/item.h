@@ -0,0 +1,71 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file item.h
+ * @author Futrime (futrime@outlook.com)
+ * @brief Declaration of the item classifier
+ * @version 1.0.0
+ * @date 2022-08-23
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#ifndef GENSHICRAFT_ITEM_H_
+#define GENSHICRAFT_ITEM_H_
+
+#include <MC/ItemStack.hpp>
+
+namespace genshicraft {
+
+namespace item {
+
+/**
+ * @brief The kinds of GenshiCraft items
+ *
+ */
+enum class Kind { kNone = 0, kArtifact, kFood, kWeapon };
+
+/**
+ * @brief The Classification struct tells what GenshiCraft item an item is.
+ *
+ */
+struct Classification {
+  Kind kind;
+  int id;      // the index in the information list of the kind, or -1
+  int rarity;  // the rarity in the type name, or 0 if not applicable
+};
+
+/**
+ * @brief Classify an item
+ *
+ * @param item The item
+ * @return The classification
+ *
+ * @note The result is cached by the native item ID, so the type name is only
+ * looked up once for each item type.
+ */
+Classification Classify(ItemStack* item);
+
+}  // namespace item
+
+}  // namespace genshicraft
+
+#endif  // GENSHICRAFT_ITEM_H_
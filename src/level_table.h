@@ -0,0 +1,167 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file level_table.h
+ * @author Futrime (futrime@outlook.com)
+ * @brief Declaration and definition of the LevelTable class
+ * @version 1.0.0
+ * @date 2022-08-19
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#ifndef GENSHICRAFT_LEVEL_TABLE_H_
+#define GENSHICRAFT_LEVEL_TABLE_H_
+
+#include <algorithm>
+
+namespace genshicraft {
+
+/**
+ * @brief The LevelTable class maps between the EXP and the level with a table
+ * of the minimum cumulative EXP of each level.
+ *
+ * @note The class is defined in the header so that the lookups can be inlined.
+ */
+class LevelTable {
+ public:
+  LevelTable() = delete;
+
+  /**
+   * @brief Construct a new LevelTable object
+   *
+   * @param level_min_exp_list The minimum EXP of each level, indexed by the
+   * level and non-decreasing from min_level to max_level
+   * @param min_level The minimum level
+   * @param max_level The maximum level
+   */
+  constexpr LevelTable(const int* level_min_exp_list, int min_level,
+                       int max_level)
+      : level_min_exp_list_(level_min_exp_list),
+        max_level_(max_level),
+        min_level_(min_level) {
+    // Empty
+  }
+
+  /**
+   * @brief Get the minimum EXP of a level
+   *
+   * @param level The level, which is clamped to the range of the table
+   * @return The minimum EXP
+   */
+  constexpr int GetEXP(int level) const {
+    level = std::max(level, this->min_level_);
+    level = std::min(level, this->max_level_);
+
+    return this->level_min_exp_list_[level];
+  }
+
+  /**
+   * @brief Get the level of an amount of EXP
+   *
+   * @param exp The EXP
+   * @return The highest level whose minimum EXP does not exceed the EXP, or
+   * the minimum level if there is none
+   */
+  constexpr int GetLevel(int exp) const {
+    // Binary search for the first level whose minimum EXP exceeds the EXP,
+    // like std::upper_bound, which is not constexpr in C++17
+    int low = this->min_level_;
+    int high = this->max_level_ + 1;
+    while (low < high) {
+      auto middle = low + (high - low) / 2;
+      if (this->level_min_exp_list_[middle] <= exp) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+
+    return std::max(low - 1, this->min_level_);
+  }
+
+  /**
+   * @brief Get the maximum level
+   *
+   * @return The maximum level
+   */
+  constexpr int GetMaxLevel() const { return this->max_level_; }
+
+  /**
+   * @brief Get the minimum level
+   *
+   * @return The minimum level
+   */
+  constexpr int GetMinLevel() const { return this->min_level_; }
+
+  /**
+   * @brief Check if GetLevel() agrees with a linear scan of the table for
+   * every EXP value
+   *
+   * @return True if they agree
+   *
+   * @note Both lookups only change their results at the table entries, so
+   * checking the EXP values around every entry covers every EXP value. This is
+   * meant for static_assert over the level tables.
+   */
+  constexpr bool CheckLookups() const {
+    for (int level = this->min_level_; level <= this->max_level_; ++level) {
+      auto entry = this->level_min_exp_list_[level];
+      for (int exp = entry - 1; exp <= entry + 1; ++exp) {
+        if (this->GetLevel(exp) != this->GetLevelByLinearScan(exp)) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+ private:
+  /**
+   * @brief Get the level of an amount of EXP by walking the table
+   *
+   * @param exp The EXP
+   * @return The level
+   *
+   * @note This is the reference for CheckLookups().
+   */
+  constexpr int GetLevelByLinearScan(int exp) const {
+    int level = this->min_level_;
+    for (int i = this->min_level_; i <= this->max_level_; ++i) {
+      if (this->level_min_exp_list_[i] <= exp) {
+        level = i;
+      } else {
+        break;
+      }
+    }
+
+    return level;
+  }
+
+  const int* level_min_exp_list_;  // the minimum EXP of each level
+  int max_level_;                  // the maximum level
+  int min_level_;                  // the minimum level
+};
+
+}  // namespace genshicraft
+
+#endif  // GENSHICRAFT_LEVEL_TABLE_H_
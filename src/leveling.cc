@@ -0,0 +1,181 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file leveling.cc
+ * @author Futrime (futrime@outlook.com)
+ * @brief Definition of leveling interfaces
+ * @version 1.0.0
+ * @date 2022-08-19
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#include "leveling.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "playerex.h"
+
+namespace genshicraft {
+
+namespace leveling {
+
+namespace {
+
+/**
+ * @brief The state of the search for the best plan
+ *
+ */
+struct PlanSearch {
+  const std::vector<int>& exp_list;
+  const std::vector<int>& count_list;
+  std::vector<int> plan;       // the plan being searched
+  std::vector<int> best_plan;  // the best plan found
+  long long best_waste = -1;   // the EXP wasted by the best plan, or -1 if no
+                               // plan is found
+  long long best_material_count = 0;  // the materials used by the best plan
+};
+
+/**
+ * @brief Search the plans from a kind of materials on
+ *
+ * @param search The search state
+ * @param index The index of the kind of materials
+ * @param remaining_exp The EXP still required
+ * @param material_count The number of materials already planned
+ *
+ * @note For each kind, either the most materials not exceeding the remaining
+ * EXP are taken and the search goes on, or one more is taken and the search
+ * stops. At most 2^n plans are visited for n kinds of materials.
+ */
+void SearchPlan(PlanSearch& search, int index, long long remaining_exp,
+                long long material_count) {
+  if (remaining_exp <= 0) {
+    long long waste = -remaining_exp;
+    if (search.best_waste < 0 || waste < search.best_waste ||
+        (waste == search.best_waste &&
+         material_count < search.best_material_count)) {
+      search.best_plan = search.plan;
+      search.best_waste = waste;
+      search.best_material_count = material_count;
+    }
+    return;
+  }
+
+  if (index == search.exp_list.size()) {  // if the materials are not enough
+    return;
+  }
+
+  int exp = search.exp_list[index];
+  int count = search.count_list[index];
+  int floor_count =
+      static_cast<int>(std::min<long long>(count, remaining_exp / exp));
+
+  search.plan[index] = floor_count;
+  SearchPlan(search, index + 1, remaining_exp - 1LL * floor_count * exp,
+             material_count + floor_count);
+
+  if (floor_count < count) {
+    search.plan[index] = floor_count + 1;
+    SearchPlan(search, index + 1, remaining_exp - 1LL * (floor_count + 1) * exp,
+               material_count + floor_count + 1);
+  }
+
+  search.plan[index] = 0;
+}
+
+}  // namespace
+
+int ConsumeEXPMaterials(
+    PlayerEx* playerex,
+    const std::vector<std::pair<std::string, int>>& material_list,
+    int required_exp) {
+  std::vector<int> exp_list;
+  std::vector<int> count_list;
+  for (const auto& [identifier, exp] : material_list) {
+    exp_list.push_back(exp);
+    count_list.push_back(playerex->GetItemCount(identifier));
+  }
+
+  auto plan = PlanEXPMaterials(exp_list, count_list, required_exp);
+
+  std::map<std::string, int> item_dict;
+  int gained_exp = 0;
+  for (int i = 0; i < material_list.size(); ++i) {
+    if (plan[i] > 0) {
+      item_dict[material_list[i].first] = plan[i];
+      gained_exp += plan[i] * material_list[i].second;
+    }
+  }
+
+  playerex->ConsumeItems(item_dict);
+
+  return gained_exp;
+}
+
+int GetEXPMaterialTotal(
+    PlayerEx* playerex,
+    const std::vector<std::pair<std::string, int>>& material_list) {
+  int total_exp = 0;
+  for (const auto& [identifier, exp] : material_list) {
+    total_exp += playerex->GetItemCount(identifier) * exp;
+  }
+
+  return total_exp;
+}
+
+std::vector<int> PlanEXPMaterials(const std::vector<int>& exp_list,
+                                  const std::vector<int>& count_list,
+                                  int required_exp) {
+  if (required_exp <= 0) {
+    return std::vector<int>(exp_list.size(), 0);
+  }
+
+  PlanSearch search{exp_list, count_list};
+  search.plan.assign(exp_list.size(), 0);
+
+  SearchPlan(search, 0, required_exp, 0);
+
+  // Use all materials if they are not enough
+  if (search.best_waste < 0) {
+    return count_list;
+  }
+
+  return search.best_plan;
+}
+
+const std::vector<std::pair<std::string, int>> kCharacterEXPMaterialList = {
+    {"genshicraft:hero_s_wit", 20000},
+    {"genshicraft:adventurer_s_experience", 5000},
+    {"genshicraft:wanderer_s_advice", 1000}};
+
+const std::vector<std::pair<std::string, int>> kWeaponEXPMaterialList = {
+    {"genshicraft:mystic_enhancement_ore", 10000},
+    {"genshicraft:fine_enhancement_ore", 2000},
+    {"genshicraft:enhancement_ore", 400}};
+
+}  // namespace leveling
+
+}  // namespace genshicraft
@@ -0,0 +1,101 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file leveling.h
+ * @author Futrime (futrime@outlook.com)
+ * @brief Declaration of leveling interfaces
+ * @version 1.0.0
+ * @date 2022-08-19
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#ifndef GENSHICRAFT_LEVELING_H_
+#define GENSHICRAFT_LEVELING_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "playerex.h"
+
+namespace genshicraft {
+
+namespace leveling {
+
+extern const std::vector<std::pair<std::string, int>>
+    kCharacterEXPMaterialList;  // the identifiers and the character EXP of
+                                // character EXP materials
+extern const std::vector<std::pair<std::string, int>>
+    kWeaponEXPMaterialList;  // the identifiers and the weapon EXP of weapon
+                             // enhancement materials
+
+/**
+ * @brief Consume EXP materials of a player to gain the EXP required
+ *
+ * @param playerex The player
+ * @param material_list The identifiers and the EXP of the materials, in
+ * descending order of the EXP
+ * @param required_exp The EXP required
+ * @return The EXP gained
+ *
+ * @note The materials are planned by leveling::PlanEXPMaterials() and removed
+ * in one inventory pass. If the materials are not enough, all of them are
+ * consumed.
+ */
+int ConsumeEXPMaterials(
+    PlayerEx* playerex,
+    const std::vector<std::pair<std::string, int>>& material_list,
+    int required_exp);
+
+/**
+ * @brief Get the total EXP of the materials owned by a player
+ *
+ * @param playerex The player
+ * @param material_list The identifiers and the EXP of the materials
+ * @return The total EXP
+ */
+int GetEXPMaterialTotal(
+    PlayerEx* playerex,
+    const std::vector<std::pair<std::string, int>>& material_list);
+
+/**
+ * @brief Plan the numbers of EXP materials to consume
+ *
+ * @param exp_list The EXP of each kind of materials, in descending order
+ * @param count_list The number of each kind of materials available
+ * @param required_exp The EXP required
+ * @return The number of each kind of materials to consume
+ *
+ * @note The plan wastes the least EXP, and then uses the fewest materials.
+ * The result is optimal when each EXP divides the previous one, as for all
+ * GenshiCraft materials. If the materials are not enough, all of them are
+ * planned.
+ */
+std::vector<int> PlanEXPMaterials(const std::vector<int>& exp_list,
+                                  const std::vector<int>& count_list,
+                                  int required_exp);
+
+}  // namespace leveling
+
+}  // namespace genshicraft
+
+#endif  // GENSHICRAFT_LEVELING_H_
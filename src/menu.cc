@@ -43,6 +43,7 @@
 
 #include "artifact.h"
 #include "character.h"
+#include "leveling.h"
 #include "playerex.h"
 #include "plugin.h"
 #include "weapon.h"
@@ -291,25 +292,25 @@ void Menu::OpenCharacterArtifacts(Artifact::Type type) {
   form = form.addLabel("set_name",
                        "§a" + artifact->GetSetName() + ": (" +
                            std::to_string(Artifact::GetSetCount(
-                               artifact->GetSetName(), this->playerex_)) +
+                               artifact->GetSetID(), this->playerex_)) +
                            ")");
 
   // Display the set effect descriptions
   form = form.addLabel(
       "set_effect_description_2",
-      ((Artifact::GetSetCount(artifact->GetSetName(), this->playerex_) >= 2)
+      ((Artifact::GetSetCount(artifact->GetSetID(), this->playerex_) >= 2)
            ? "§a☑"
            : "§7⊘") +
           std::string("2-Piece Set: ") +
-          Artifact::GetSetEffectDescription(artifact->GetSetName()).at(0));
+          Artifact::GetSetEffectDescription(artifact->GetSetID()).at(0));
 
   form = form.addLabel(
       "set_effect_description_4",
-      ((Artifact::GetSetCount(artifact->GetSetName(), this->playerex_) >= 4)
+      ((Artifact::GetSetCount(artifact->GetSetID(), this->playerex_) >= 4)
            ? "§a☑"
            : "§7⊘") +
           std::string("4-Piece Set: ") +
-          Artifact::GetSetEffectDescription(artifact->GetSetName()).at(1));
+          Artifact::GetSetEffectDescription(artifact->GetSetID()).at(1));
 
   if (artifact->GetLevel() < artifact->GetLevelMax()) {
     // Calculate the maximum levels to increase
@@ -324,13 +325,13 @@ void Menu::OpenCharacterArtifacts(Artifact::Type type) {
         continue;
       };
 
-      auto artifact_to_consume = Artifact::Make(item, this->playerex_);
-      if (artifact_to_consume->GetBaseConsumableEXP() + mora_to_consume <=
+      auto artifact_to_consume = Artifact::MakeView(item);
+      if (artifact_to_consume.base_consumable_exp + mora_to_consume <=
           this->playerex_->GetMoraCount()) {
-        mora_to_consume += artifact_to_consume->GetBaseConsumableEXP();
+        mora_to_consume += artifact_to_consume.base_consumable_exp;
         artifact_EXP +=
-            artifact_to_consume->GetBaseConsumableEXP() +
-            static_cast<int>(artifact_to_consume->GetArtifactEXP() * 0.8);
+            artifact_to_consume.base_consumable_exp +
+            static_cast<int>(artifact_to_consume.artifact_exp * 0.8);
       }
     }
 
@@ -384,24 +385,21 @@ void Menu::OpenCharacterArtifacts(Artifact::Type type) {
             continue;
           };
 
-          auto artifact_to_consume = Artifact::Make(item, this->playerex_);
+          auto artifact_to_consume = Artifact::MakeView(item);
 
-          if (artifact_to_consume->GetBaseConsumableEXP() >
+          if (artifact_to_consume.base_consumable_exp >
               this->playerex_->GetMoraCount()) {  // if the mora is not enough
             continue;
           }
 
           // Increase the artifact EXP
           artifact->IncreaseArtifactEXP(
-              artifact_to_consume->GetBaseConsumableEXP() +
-              static_cast<int>(0.8 * artifact_to_consume->GetArtifactEXP()));
+              artifact_to_consume.base_consumable_exp +
+              static_cast<int>(0.8 * artifact_to_consume.artifact_exp));
 
           // Consume the mora and the artifact consumable
-          this->playerex_->ConsumeMora(
-              artifact_to_consume->GetBaseConsumableEXP());
+          this->playerex_->ConsumeMora(artifact_to_consume.base_consumable_exp);
 
-          artifact_to_consume.reset();
-          
           this->playerex_->GetPlayer()->getInventory().removeItem_s(i, 1);
         }
         Schedule::nextTick(
@@ -527,11 +525,8 @@ void Menu::OpenCharacterLevelUp() {
     return;
   }
 
-  auto max_character_exp =
-      this->playerex_->GetItemCount("genshicraft:wanderer_s_advice") * 1000 +
-      this->playerex_->GetItemCount("genshicraft:adventurer_s_experience") *
-          5000 +
-      this->playerex_->GetItemCount("genshicraft:hero_s_wit") * 20000;
+  auto max_character_exp = leveling::GetEXPMaterialTotal(
+      this->playerex_, leveling::kCharacterEXPMaterialList);
 
   auto max_up_level = character->GetLevelByCharacterEXP(
       max_character_exp + character->GetCharacterEXP());
@@ -559,26 +554,11 @@ void Menu::OpenCharacterLevelUp() {
         auto enhanced_level =
             data.at("level")->getInt() + character->GetLevel();
 
-        while (character->GetLevel() < enhanced_level &&
-               this->playerex_->GetItemCount("genshicraft:hero_s_wit") > 0) {
-          this->playerex_->ConsumeItem("genshicraft:hero_s_wit", 1);
-          character->IncreaseCharacterEXP(20000);
-        }
-
-        while (character->GetLevel() < enhanced_level &&
-               this->playerex_->GetItemCount(
-                   "genshicraft:adventurer_s_experience") > 0) {
-          this->playerex_->ConsumeItem("genshicraft:adventurer_s_experience",
-                                       1);
-          character->IncreaseCharacterEXP(5000);
-        }
-
-        while (character->GetLevel() < enhanced_level &&
-               this->playerex_->GetItemCount("genshicraft:wanderer_s_advice") >
-                   0) {
-          this->playerex_->ConsumeItem("genshicraft:wanderer_s_advice", 1);
-          character->IncreaseCharacterEXP(1000);
-        }
+        // Consume the materials wasting the least character EXP
+        character->IncreaseCharacterEXP(leveling::ConsumeEXPMaterials(
+            this->playerex_, leveling::kCharacterEXPMaterialList,
+            character->GetCharacterEXPByLevel(enhanced_level) -
+                character->GetCharacterEXP()));
 
         Schedule::nextTick([this]() { this->OpenCharacterLevelUp(); });
       });
@@ -778,11 +758,8 @@ void Menu::OpenCharacterWeaponEnhance() {
     return;
   }
 
-  auto max_weapon_exp =
-      this->playerex_->GetItemCount("genshicraft:enhancement_ore") * 400 +
-      this->playerex_->GetItemCount("genshicraft:fine_enhancement_ore") * 2000 +
-      this->playerex_->GetItemCount("genshicraft:mystic_enhancement_ore") *
-          10000;
+  auto max_weapon_exp = leveling::GetEXPMaterialTotal(
+      this->playerex_, leveling::kWeaponEXPMaterialList);
 
   auto max_enhanced_level =
       weapon->GetLevelByWeaponEXP(max_weapon_exp + weapon->GetWeaponEXP());
@@ -815,26 +792,11 @@ void Menu::OpenCharacterWeaponEnhance() {
 
         auto enhanced_level = data.at("level")->getInt() + weapon->GetLevel();
 
-        while (weapon->GetLevel() < enhanced_level &&
-               this->playerex_->GetItemCount(
-                   "genshicraft:mystic_enhancement_ore") > 0) {
-          this->playerex_->ConsumeItem("genshicraft:mystic_enhancement_ore", 1);
-          weapon->IncreaseWeaponEXP(10000);
-        }
-
-        while (weapon->GetLevel() < enhanced_level &&
-               this->playerex_->GetItemCount(
-                   "genshicraft:fine_enhancement_ore") > 0) {
-          this->playerex_->ConsumeItem("genshicraft:fine_enhancement_ore", 1);
-          weapon->IncreaseWeaponEXP(2000);
-        }
-
-        while (weapon->GetLevel() < enhanced_level &&
-               this->playerex_->GetItemCount("genshicraft:enhancement_ore") >
-                   0) {
-          this->playerex_->ConsumeItem("genshicraft:enhancement_ore", 1);
-          weapon->IncreaseWeaponEXP(400);
-        }
+        // Consume the materials wasting the least weapon EXP
+        weapon->IncreaseWeaponEXP(leveling::ConsumeEXPMaterials(
+            this->playerex_, leveling::kWeaponEXPMaterialList,
+            weapon->GetWeaponEXPByLevel(enhanced_level) -
+                weapon->GetWeaponEXP()));
 
         Schedule::nextTick([this]() { this->OpenCharacterWeaponEnhance(); });
       });
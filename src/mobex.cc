@@ -34,10 +34,13 @@
 #include <MC/Level.hpp>
 #include <MC/Mob.hpp>
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <random>
+#include <string>
 #include <third-party/Base64/Base64.hpp>
 #include <third-party/Nlohmann/json.hpp>
+#include <unordered_map>
 
 #include "actorex.h"
 #include "damage.h"
@@ -64,6 +67,10 @@ void MobEx::ApplyDamage(const Damage& damage) {
   this->latest_damage_.SetVictimStats(this->GetStats());
 
   this->IncreaseHP(static_cast<int>(-damage.Get()));
+
+  // Write the record right away since the mob may despawn or be unloaded
+  // before the next checkpoint, after which it could no longer be written
+  this->WriteData();
 }
 
 int MobEx::GetHP() const { return this->HP_; }
@@ -82,12 +89,58 @@ void MobEx::IncreaseHP(int value) {
   // Restrict the HP in a reasonable range
   this->HP_ = std::max(this->HP_, 0);
   this->HP_ = std::min(this->HP_, this->GetStats().GetMaxHP());
+
+  this->is_data_modified_ = true;
 }
 
 bool MobEx::IsMob() const { return true; }
 
 void MobEx::SetLastNativeHealth(int health) {
-  this->last_native_health_ = health;
+  if (health != this->last_native_health_) {
+    this->last_native_health_ = health;
+    this->is_data_modified_ = true;
+  }
+}
+
+bool MobEx::CheckDataRecords() {
+  // Every field has a distinct value so that swapped fields are caught
+  const Data kDataList[] = {
+      {0, 0, 0, 0, 0},
+      {90, 123456, 65432, 987, 20},
+      {-1, std::numeric_limits<int>::min(), std::numeric_limits<int>::max(),
+       -2, 1},
+  };
+  for (const auto& data : kDataList) {
+    auto payload = MobEx::EncodeData(data);
+    if (payload.find('=') != std::string::npos) {
+      return false;
+    }
+
+    Data decoded_data = {};
+    bool is_legacy = true;
+    if (!MobEx::DecodeData(payload, &decoded_data, &is_legacy) ||
+        decoded_data.level != data.level ||
+        decoded_data.max_HP_base != data.max_HP_base ||
+        decoded_data.HP != data.HP || decoded_data.ATK_base != data.ATK_base ||
+        decoded_data.last_native_health != data.last_native_health ||
+        is_legacy) {
+      return false;
+    }
+  }
+
+  // The legacy JSON data without a version, which is migrated
+  Data data = {};
+  bool is_legacy = false;
+  if (!MobEx::DecodeData(
+          Base64::Encode(R"({"level":42,"max_HP":1000,"HP":500,"ATK":30,)"
+                         R"("last_minecraft_health":20})"),
+          &data, &is_legacy) ||
+      data.level != 42 || data.max_HP_base != 1000 || data.HP != 500 ||
+      data.ATK_base != 30 || data.last_native_health != 20 || !is_legacy) {
+    return false;
+  }
+
+  return true;
 }
 
 std::shared_ptr<MobEx> MobEx::Get(long long unique_id) {
@@ -107,13 +160,62 @@ std::shared_ptr<MobEx> MobEx::Make(Mob* mob) {
     return playerex;
   }
 
+  auto unique_id = mob->getUniqueID().get();
+
+  // Return the cached MobEx object if it exists
+  auto iter = MobEx::all_mobex_.find(unique_id);
+  if (iter != MobEx::all_mobex_.end()) {
+    return iter->second;
+  }
+
   auto mobex = std::make_shared<MobEx>(mob);
 
   mobex->LoadData();
 
+  MobEx::all_mobex_[unique_id] = mobex;
+
   return mobex;
 }
 
+void MobEx::OnTick() {
+  static int tick_count = 0;
+
+  ++tick_count;
+  if (tick_count < MobEx::kCheckpointInterval) {
+    return;
+  }
+  tick_count = 0;
+
+  for (auto iter = MobEx::all_mobex_.begin();
+       iter != MobEx::all_mobex_.end();) {
+    if (iter->second->GetMob() == nullptr) {  // if the mob has been unloaded
+      iter = MobEx::all_mobex_.erase(iter);
+      continue;
+    }
+
+    if (iter->second->is_data_modified_) {
+      iter->second->WriteData();
+    }
+
+    ++iter;
+  }
+}
+
+void MobEx::UnloadAll() {
+  // The records are written on every hit, so skip the write-back on
+  // destruction, which would look the mobs up in a Level being torn down
+  for (const auto& [unique_id, mobex] : MobEx::all_mobex_) {
+    mobex->is_data_saved_ = true;
+  }
+
+  MobEx::all_mobex_.clear();
+}
+
+void MobEx::UnloadMob(Mob* mob) {
+  MobEx::all_mobex_.erase(
+      mob->getUniqueID().get());  // the data is written back on destruction
+}
+
 void MobEx::LoadData() {
   static std::default_random_engine random_engine;
 
@@ -123,71 +225,70 @@ void MobEx::LoadData() {
     throw ExceptionMobNotFound();
   }
 
-  nlohmann::json data;  // the mob data
+  bool is_data_found = false;
 
-  // Attempt to get the data from tags of the Mob object
+  // Attempt to get the data from tags of the Mob object. The tag is kept since
+  // the MobEx object is cached and writes the data back only when modified.
   for (const auto& tag : mob->getAllTags()) {
     if (tag.substr(0, 12) == "genshicraft_") {
-      try {
-        data = nlohmann::json::parse(Base64::Decode(tag.substr(12)));
-
-      } catch (const nlohmann::json::parse_error&) {
-        mob->removeTag(tag);  // remove the malformed tag
+      if (is_data_found || !this->ReadData(tag.substr(12))) {
+        mob->removeTag(tag);  // remove the redundant or malformed tag
         continue;
       }
 
-      mob->removeTag(
-          tag);  // the tag will be written back at the end of this method
-      break;
+      is_data_found = true;
     }
   }
 
-  // Remove all GenshiCraft data tags
-  for (const auto& tag : mob->getAllTags()) {
-    if (tag.substr(0, 12) == "genshicraft_") {
-      mob->removeTag(tag);
-    }
-  }
-
-  // Migrate the data and check its validity
-  data = MobEx::MigrateData(data);
-
-  // Initialize the mob with template data if the mob is not initialized or the
-  // data is invalid
-  if (data.empty()) {
+  // Initialize the mob if the mob is not initialized or the data is invalid
+  if (!is_data_found) {
     std::uniform_int_distribution dist(-10, 1);
 
-    data["version"] = MobEx::kMobExDataFormatVersion;
-
-    data["level"] =
+    this->level_ =
         world::GetWorldLevel(mob->getPosition(), mob->getDimension()) * 11 +
         dist(random_engine);
 
-    data["max_HP"] = static_cast<int>(
-        mob->getMaxHealth() *
-        world::GetEnemyMaxHPMultiplier(data["level"].get<int>()) * 3.65);
+    this->stats_.max_HP_base = static_cast<int>(
+        mob->getMaxHealth() * world::GetEnemyMaxHPMultiplier(this->level_) *
+        3.65);
+
+    this->HP_ = static_cast<int>(1. * this->stats_.max_HP_base *
+                                 mob->getHealth() / mob->getMaxHealth());
+
+    this->stats_.ATK_base =
+        0;  // the ATK cannot be set until the mob performs an attack
+
+    this->last_native_health_ = mob->getHealth();
 
-    data["HP"] = static_cast<int>(data["max_HP"].get<double>() *
-                                  mob->getHealth() / mob->getMaxHealth());
+    this->is_data_modified_ = true;
+  }
 
-    data["ATK"] = 0;  // the ATK cannot be set until the mob performs an attack
+  this->stats_.DEF_base = this->level_ * 5 + 500;
 
-    data["last_native_health"] = mob->getHealth();
+  // Write the new or migrated data back to the tags
+  if (this->is_data_modified_) {
+    this->WriteData();
+  }
+}
 
-    // Write the data to a tag of the Mob object
-    auto tag = Base64::Encode(nlohmann::to_string(data));
-    tag = tag.substr(
-        0, tag.find(
-               '='));  // remove the "=" characters which are forbidden in tags
-    mob->addTag("genshicraft_" + tag);
+bool MobEx::ReadData(const std::string& payload) {
+  Data data;
+  bool is_legacy = false;
+  if (!MobEx::DecodeData(payload, &data, &is_legacy)) {
+    return false;
   }
 
-  this->HP_ = data["HP"].get<int>();
-  this->last_native_health_ = data["last_native_health"].get<int>();
-  this->level_ = data["level"];
-  this->stats_.max_HP_base = data["max_HP"].get<int>();
-  this->stats_.ATK_base = data["ATK"].get<int>();
-  this->stats_.DEF_base = data["level"].get<int>() * 5 + 500;
+  this->level_ = data.level;
+  this->stats_.max_HP_base = data.max_HP_base;
+  this->HP_ = data.HP;
+  this->stats_.ATK_base = data.ATK_base;
+  this->last_native_health_ = data.last_native_health;
+
+  if (is_legacy) {
+    this->is_data_modified_ = true;  // rewrite in the binary format
+  }
+
+  return true;
 }
 
 void MobEx::SaveData() {
@@ -197,6 +298,15 @@ void MobEx::SaveData() {
 
   this->is_data_saved_ = true;
 
+  // Nothing to do if the tags are up to date
+  if (!this->is_data_modified_) {
+    return;
+  }
+
+  this->WriteData();
+}
+
+void MobEx::WriteData() {
   auto mob = this->GetMob();
 
   // Nothing to do if the mob no longer exists
@@ -211,21 +321,70 @@ void MobEx::SaveData() {
     }
   }
 
-  nlohmann::json data;
-  data["version"] = MobEx::kMobExDataFormatVersion;
-  data["level"] = this->level_;  // the data value should be the most original
-                                 // value so do not use this->GetLevel()
-  data["max_HP"] = this->stats_.max_HP_base;
-  data["HP"] = this->HP_;
-  data["ATK"] = this->stats_.ATK_base;
-  data["last_native_health"] = this->last_native_health_;
-
-  // Write the data to a tag of the Mob object
-  auto tag = Base64::Encode(nlohmann::to_string(data));
-  tag = tag.substr(
-      0,
-      tag.find('='));  // remove the "=" characters which are forbidden in tags
-  mob->addTag("genshicraft_" + tag);
+  // Write the data to a tag of the Mob object. The data value should be the
+  // most original value so do not use this->GetLevel().
+  mob->addTag("genshicraft_" +
+              MobEx::EncodeData({this->level_, this->stats_.max_HP_base,
+                                 this->HP_, this->stats_.ATK_base,
+                                 this->last_native_health_}));
+
+  this->is_data_modified_ = false;
+}
+
+bool MobEx::DecodeData(const std::string& payload, Data* data,
+                       bool* is_legacy) {
+  auto record = Base64::Decode(payload);
+
+  // Read the legacy JSON data
+  if (!record.empty() && record.front() == '{') {
+    nlohmann::json json_data;
+    try {
+      json_data = nlohmann::json::parse(record);
+    } catch (const nlohmann::json::parse_error&) {
+      return false;
+    }
+
+    json_data = MobEx::MigrateData(json_data);
+    if (json_data.empty()) {
+      return false;
+    }
+
+    data->level = json_data["level"].get<int>();
+    data->max_HP_base = json_data["max_HP"].get<int>();
+    data->HP = json_data["HP"].get<int>();
+    data->ATK_base = json_data["ATK"].get<int>();
+    data->last_native_health = json_data["last_native_health"].get<int>();
+
+    *is_legacy = true;
+    return true;
+  }
+
+  if (record.size() != MobEx::kMobExRecordSize ||
+      record.front() != MobEx::kMobExDataFormatVersion) {
+    return false;
+  }
+
+  data->level = ActorEx::ReadRecordInt(record, 1);
+  data->max_HP_base = ActorEx::ReadRecordInt(record, 5);
+  data->HP = ActorEx::ReadRecordInt(record, 9);
+  data->ATK_base = ActorEx::ReadRecordInt(record, 13);
+  data->last_native_health = ActorEx::ReadRecordInt(record, 17);
+
+  *is_legacy = false;
+  return true;
+}
+
+std::string MobEx::EncodeData(const Data& data) {
+  std::string record(1, static_cast<char>(MobEx::kMobExDataFormatVersion));
+  ActorEx::WriteRecordInt(record, data.level);
+  ActorEx::WriteRecordInt(record, data.max_HP_base);
+  ActorEx::WriteRecordInt(record, data.HP);
+  ActorEx::WriteRecordInt(record, data.ATK_base);
+  ActorEx::WriteRecordInt(record, data.last_native_health);
+
+  // The record is a multiple of 3 bytes long, so there are no "=" characters,
+  // which are forbidden in tags
+  return Base64::Encode(record);
 }
 
 nlohmann::json MobEx::MigrateData(const nlohmann::json& old_data) {
@@ -257,4 +416,6 @@ nlohmann::json MobEx::MigrateData(const nlohmann::json& old_data) {
   return data;
 }
 
+std::unordered_map<long long, std::shared_ptr<MobEx>> MobEx::all_mobex_ = {};
+
 }  // namespace genshicraft
@@ -31,7 +31,9 @@
 
 #include <MC/Mob.hpp>
 #include <memory>
+#include <string>
 #include <third-party/Nlohmann/json.hpp>
+#include <unordered_map>
 
 #include "actorex.h"
 #include "damage.h"
@@ -121,6 +123,16 @@ class MobEx : public ActorEx {
    */
   virtual void SetLastNativeHealth(int health);
 
+  /**
+   * @brief Check that the data records survive a round trip through the tag
+   * payload, and that the legacy JSON data is still accepted
+   *
+   * @return True if the check passed
+   *
+   * @note This method does not touch the Level, so it can be called at load.
+   */
+  static bool CheckDataRecords();
+
   /**
    * @brief Get a MobEx object by a unique ID
    *
@@ -141,13 +153,58 @@ class MobEx : public ActorEx {
    */
   static std::shared_ptr<MobEx> Make(Mob* mob);
 
+  /**
+   * @brief This method executes per tick.
+   *
+   * @note Every kCheckpointInterval ticks, the modified data of all cached
+   * MobEx objects is written back to the tags and the objects of unloaded mobs
+   * are dropped from the cache. The data changed by a hit is written at once
+   * in MobEx::ApplyDamage(), so it is not lost if the mob is unloaded before
+   * the checkpoint.
+   */
+  static void OnTick();
+
+  /**
+   * @brief Clear the cache of MobEx objects
+   *
+   * @note This method should be called when the server stops. It does not
+   * write the data back since the Level may already be torn down, and the
+   * records are written on every hit anyway.
+   */
+  static void UnloadAll();
+
+  /**
+   * @brief Write back the data of a MobEx object and drop it from the cache
+   *
+   * @param mob A pointer to the Mob object
+   */
+  static void UnloadMob(Mob* mob);
+
  protected:
   int HP_;
   Damage latest_damage_;
   int last_native_health_;
 
  private:
-  inline static const int kMobExDataFormatVersion = 1;
+  /**
+   * @brief The Data struct contains the data stored in a data tag.
+   *
+   */
+  struct Data {
+    int level;               // the level
+    int max_HP_base;         // the base max HP
+    int HP;                  // the HP
+    int ATK_base;            // the base ATK
+    int last_native_health;  // the native health last time processed
+  };
+
+  inline static const int kCheckpointInterval =
+      200;  // the interval in ticks between two data write-backs
+  inline static const int kMobExDataFormatVersion = 2;
+  inline static const int kMobExRecordSize =
+      21;  // the size of the binary data record: the version (1 byte), the
+           // level, the max HP, the HP, the ATK and the last native health (4
+           // bytes each)
 
   /**
    * @brief Load the data
@@ -156,6 +213,16 @@ class MobEx : public ActorEx {
    */
   virtual void LoadData() override;
 
+  /**
+   * @brief Read the data from the payload of a data tag
+   *
+   * @param payload The tag without the "genshicraft_" prefix
+   * @return True if the data is valid
+   *
+   * @note Both the binary records and the legacy JSON data are accepted.
+   */
+  bool ReadData(const std::string& payload);
+
   /**
    * @brief Save the data
    *
@@ -164,15 +231,43 @@ class MobEx : public ActorEx {
   virtual void SaveData() override;
 
   /**
-   * @brief Migrate the data with previous data format version to current
-   * version.
+   * @brief Write the data to the tags of the Mob object
+   *
+   * @note Unlike MobEx::SaveData(), this method can be called many times.
+   */
+  void WriteData();
+
+  /**
+   * @brief Decode the payload of a data tag
+   *
+   * @param payload The tag without the "genshicraft_" prefix
+   * @param data The data decoded
+   * @param is_legacy Set to true if the payload is legacy JSON data
+   * @return True if the data is valid
+   */
+  static bool DecodeData(const std::string& payload, Data* data,
+                         bool* is_legacy);
+
+  /**
+   * @brief Encode the data to the payload of a data tag
+   *
+   * @param data The data
+   * @return The tag without the "genshicraft_" prefix
+   */
+  static std::string EncodeData(const Data& data);
+
+  /**
+   * @brief Migrate the legacy JSON data to the last JSON data format version
    *
    * @param old_data The data to migrate
-   * @return The data with current data format version
+   * @return The data with JSON data format version 1
    *
    * @note If the data is invalid, this method will return an empty JSON object.
    */
   static nlohmann::json MigrateData(const nlohmann::json& old_data);
+
+  static std::unordered_map<long long, std::shared_ptr<MobEx>>
+      all_mobex_;  // the cached MobEx objects of non-player mobs
 };
 
 }  // namespace genshicraft
@@ -36,15 +36,15 @@
 
 namespace genshicraft {
 
-Modifier::Modifier(Stats stats, double expired_clock)
+Modifier::Modifier(Stats stats, long long expired_tick)
     : id_(Modifier::GenerateID()),
-      expired_clock_(expired_clock),
+      expired_tick_(expired_tick),
       stats_(stats),
       type_(Modifier::Type::kStats) {
   // Empty
 }
 
-double Modifier::GetExpiredClock() const { return this->expired_clock_; }
+long long Modifier::GetExpiredTick() const { return this->expired_tick_; }
 
 int Modifier::GetID() const { return this->id_; }
 
@@ -54,16 +54,16 @@ class Modifier {
    * @brief Construct a new stats Modifier object
    *
    * @param stats The stats
-   * @param expired_clock The expired clock
+   * @param expired_tick The tick when the modifier expires
    */
-  Modifier(Stats stats, double expired_clock);
+  Modifier(Stats stats, long long expired_tick);
 
   /**
-   * @brief Get the expired clock
+   * @brief Get the tick when the modifier expires
    *
-   * @return The expired clock
+   * @return The tick
    */
-  double GetExpiredClock() const;
+  long long GetExpiredTick() const;
 
   /**
    * @brief Get the the modifier ID
@@ -97,7 +97,7 @@ class Modifier {
 
  private:
   int id_;                  // the ID
-  double expired_clock_;    // the clock when the modifier expired
+  long long expired_tick_;  // the tick when the modifier expires
   Stats stats_;  // the stats
   Type type_;
 
@@ -32,8 +32,6 @@
 
 #include <EventAPI.h>
 #include <GlobalServiceAPI.h>
-#include <KVDBAPI.h>
-#include <ScheduleAPI.h>
 
 #include <MC/ActorUniqueID.hpp>
 #include <MC/Block.hpp>
@@ -45,21 +43,26 @@
 #include <MC/SimpleContainer.hpp>
 #include <MC/Types.hpp>
 #include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <map>
 #include <memory>
-#include <random>
 #include <string>
 #include <third-party/Nlohmann/json.hpp>
+#include <unordered_map>
 #include <vector>
 
 #include "artifact.h"
 #include "character.h"
 #include "damage.h"
+#include "database.h"
 #include "exceptions.h"
 #include "menu.h"
 #include "mobex.h"
 #include "plugin.h"
+#include "profiler.h"
 #include "sidebar.h"
+#include "stamina.h"
 #include "stats.h"
 #include "weapon.h"
 #include "world.h"
@@ -68,14 +71,26 @@ namespace genshicraft {
 
 PlayerEx::PlayerEx(Player* player)
     : MobEx(player),
+      artifact_summary_(),
+      is_artifact_summary_valid_(false),
+      is_item_count_valid_(false),
+      is_items_refresh_pending_(false),
       is_opening_container_(false),
+      is_weapon_cache_valid_(false),
       last_world_level_(0),
       menu_(Menu(this)),
+      offhand_artifact_view_(),
       sidebar_(Sidebar(this)),
       stamina_(0),
       stamina_max_(0),
+      stamina_rate_(0),
+      stamina_tick_(GetNowTick()),
+      tick_offset_(PlayerEx::next_tick_offset_++),
+      weapon_cache_item_(nullptr),
       xuid_(player->getXuid()) {
-  // Empty
+  // Wait for the first slot of each job
+  std::fill(std::begin(this->tick_job_last_tick_list_),
+            std::end(this->tick_job_last_tick_list_), GetNowTick() - 1);
 }
 
 PlayerEx::~PlayerEx() { this->SaveData(); }
@@ -92,25 +107,42 @@ void PlayerEx::ApplyDamage(const Damage& damage) {
 }
 
 void PlayerEx::ConsumeItem(std::string identifier, int value) {
-  // Check if the items are enough for consumption
-  if (this->GetItemCount(identifier) < value) {
-    throw ExceptionItemsNotEnough();
+  this->ConsumeItems({{identifier, value}});
+}
+
+void PlayerEx::ConsumeItems(const std::map<std::string, int>& item_dict) {
+  // Check if the items are enough for consumption. This function is only for
+  // item consumption, so non-positive numbers are skipped.
+  std::map<std::string, int> remaining_dict;
+  for (const auto& [identifier, value] : item_dict) {
+    if (this->GetItemCount(identifier) < value) {
+      throw ExceptionItemsNotEnough();
+    }
+
+    if (value > 0) {
+      remaining_dict[identifier] = value;
+    }
   }
 
-  // This function is only for item consumption
-  if (value <= 0) {
+  if (remaining_dict.empty()) {
     return;
   }
 
   auto& inventory = this->GetPlayer()->getInventory();
-  for (int i = 0; i < inventory.getSize(); ++i) {
-    if (inventory.getSlot(i)->getTypeName() == identifier) {
-      int consumed_value = std::min(value, inventory.getSlot(i)->getCount());
-      inventory.removeItem_s(i, consumed_value);
-      value -= consumed_value;
-      if (value <= 0) {
-        break;
-      }
+  for (int i = 0; i < inventory.getSize() && !remaining_dict.empty(); ++i) {
+    auto iter = remaining_dict.find(inventory.getSlot(i)->getTypeName());
+    if (iter == remaining_dict.end()) {
+      continue;
+    }
+
+    int consumed_value =
+        std::min(iter->second, inventory.getSlot(i)->getCount());
+    inventory.removeItem_s(i, consumed_value);
+    this->UpdateItemCount(i, inventory.getSlot(i));
+
+    iter->second -= consumed_value;
+    if (iter->second <= 0) {
+      remaining_dict.erase(iter);
     }
   }
 
@@ -127,6 +159,9 @@ void PlayerEx::ConsumeMora(int value) {
 
   mora_count -= value;
 
+  // The slots changed by clearing and giving items are unknown
+  this->is_item_count_valid_ = false;
+
   // Clear all mora
   this->GetPlayer()->clearItem("genshicraft:mora_10000");
   this->GetPlayer()->clearItem("genshicraft:mora_5000");
@@ -156,17 +191,9 @@ std::vector<std::shared_ptr<Character>> PlayerEx::GetAllCharacters() const {
 
 std::map<Artifact::Type, std::shared_ptr<Artifact>> PlayerEx::GetArtifactDict()
     const {
-  std::vector<ItemStack*> item_list;
-  item_list.push_back(this->GetPlayer()->getArmorContainer().getSlot(0));
-  item_list.push_back(this->GetPlayer()->getArmorContainer().getSlot(1));
-  item_list.push_back(this->GetPlayer()->getArmorContainer().getSlot(2));
-  item_list.push_back(this->GetPlayer()->getArmorContainer().getSlot(3));
-  item_list.push_back(
-      const_cast<ItemStack*>(&(this->GetPlayer()->getOffhandSlot())));
-
   std::map<Artifact::Type, std::shared_ptr<Artifact>> artifact_dict;
 
-  for (auto&& item : item_list) {
+  for (auto&& item : this->GetArtifactItemList()) {
     if (Artifact::CheckIsArtifact(item)) {
       auto artifact = Artifact::Make(item, const_cast<PlayerEx*>(this));
       artifact_dict[artifact->GetType()] = artifact;
@@ -176,18 +203,40 @@ std::map<Artifact::Type, std::shared_ptr<Artifact>> PlayerEx::GetArtifactDict()
   return artifact_dict;
 }
 
+const Artifact::Summary& PlayerEx::GetArtifactSummary() const {
+  if (!this->is_artifact_summary_valid_) {
+    this->RebuildArtifactSummary();
+  }
+
+  return this->artifact_summary_;
+}
+
+std::map<Artifact::Type, Artifact::View> PlayerEx::GetArtifactViewDict()
+    const {
+  std::map<Artifact::Type, Artifact::View> view_dict;
+
+  for (auto&& item : this->GetArtifactItemList()) {
+    if (Artifact::CheckIsArtifact(item)) {
+      auto view = Artifact::MakeView(item);
+      view_dict[view.info->type] = view;
+    }
+  }
+
+  return view_dict;
+}
+
 Damage PlayerEx::GetAttackDamage() const {
   if (this->GetWeapon()) {  // if the player attacks with a GenshiCraft weapon
     return this->GetCharacter()->GetDamageNormalAttack();
   } else {
-    static double last_attack_clock =
-        GetNowClock() - 999999.;  // the clock of the last attack
+    static long long last_attack_tick =
+        GetNowTick() - 999999;  // the tick of the last attack
 
-    // Prevent too frequent attack
-    if (GetNowClock() - last_attack_clock < 0.5) {
+    // Prevent too frequent attack, i.e. more than once per 0.5s
+    if (GetNowTick() - last_attack_tick < kTicksPerSecond / 2) {
       return Damage();
     }
-    last_attack_clock = GetNowClock();
+    last_attack_tick = GetNowTick();
 
     Stats stats;
     stats.ATK_base = static_cast<int>(this->GetStats().GetATK() * 0.1974);
@@ -210,16 +259,18 @@ std::shared_ptr<Character> PlayerEx::GetCharacter() const {
 int PlayerEx::GetHP() const { return this->GetCharacter()->GetHP(); }
 
 int PlayerEx::GetItemCount(std::string identifier) const {
-  auto& inventory = this->GetPlayer()->getInventory();
+  if (!this->is_item_count_valid_) {
+    this->RebuildItemCount();
+  }
 
-  int item_count = 0;
-  for (auto&& item : inventory.getAllSlots()) {
-    if (identifier == item->getTypeName()) {
-      item_count += item->getCount();
-    }
+  // Items never seen have no interned ID yet
+  auto iter = PlayerEx::item_id_dict_.find(identifier);
+  if (iter == PlayerEx::item_id_dict_.end() ||
+      iter->second >= this->item_count_list_.size()) {
+    return 0;
   }
 
-  return item_count;
+  return this->item_count_list_[iter->second];
 }
 
 int PlayerEx::GetLastNativeHealth() const { throw ExceptionMethodNotAllowed(); }
@@ -231,16 +282,28 @@ Stats PlayerEx::GetStats() const { return this->GetCharacter()->GetStats(); }
 Menu& PlayerEx::GetMenu() { return this->menu_; }
 
 int PlayerEx::GetMoraCount() const {
+  // The interned IDs and the values of the mora
+  static const std::pair<int, int> kMoraList[9] = {
+      {PlayerEx::GetItemID("genshicraft:mora_10000"), 10000},
+      {PlayerEx::GetItemID("genshicraft:mora_5000"), 5000},
+      {PlayerEx::GetItemID("genshicraft:mora_1000"), 1000},
+      {PlayerEx::GetItemID("genshicraft:mora_500"), 500},
+      {PlayerEx::GetItemID("genshicraft:mora_100"), 100},
+      {PlayerEx::GetItemID("genshicraft:mora_50"), 50},
+      {PlayerEx::GetItemID("genshicraft:mora_10"), 10},
+      {PlayerEx::GetItemID("genshicraft:mora_5"), 5},
+      {PlayerEx::GetItemID("genshicraft:mora_1"), 1}};
+
+  if (!this->is_item_count_valid_) {
+    this->RebuildItemCount();
+  }
+
   int mora_count = 0;
-  mora_count += this->GetItemCount("genshicraft:mora_10000") * 10000;
-  mora_count += this->GetItemCount("genshicraft:mora_5000") * 5000;
-  mora_count += this->GetItemCount("genshicraft:mora_1000") * 1000;
-  mora_count += this->GetItemCount("genshicraft:mora_500") * 500;
-  mora_count += this->GetItemCount("genshicraft:mora_100") * 100;
-  mora_count += this->GetItemCount("genshicraft:mora_50") * 50;
-  mora_count += this->GetItemCount("genshicraft:mora_10") * 10;
-  mora_count += this->GetItemCount("genshicraft:mora_5") * 5;
-  mora_count += this->GetItemCount("genshicraft:mora_1") * 1;
+  for (const auto& [id, value] : kMoraList) {
+    if (id < this->item_count_list_.size()) {
+      mora_count += this->item_count_list_[id] * value;
+    }
+  }
 
   return mora_count;
 }
@@ -249,17 +312,34 @@ Player* PlayerEx::GetPlayer() const {
   return Global<Level>->getPlayer(this->xuid_);
 }
 
-int PlayerEx::GetStamina() const { return this->stamina_; }
+const Sidebar& PlayerEx::GetSidebar() const { return this->sidebar_; }
+
+int PlayerEx::GetStamina() const {
+  return this->GetStaminaMilli() / stamina::kScale;
+}
 
 int PlayerEx::GetStaminaMax() const { return this->stamina_max_; }
 
 std::shared_ptr<Weapon> PlayerEx::GetWeapon() const {
   auto mainhand_item = this->GetPlayer()->getHandSlot();
+
+  // Return the cached Weapon object if the held item is not changed
+  if (this->is_weapon_cache_valid_ &&
+      mainhand_item == this->weapon_cache_item_) {
+    return this->weapon_cache_;
+  }
+
   if (Weapon::CheckIsWeapon(mainhand_item)) {
-    return Weapon::Make(mainhand_item, const_cast<PlayerEx*>(this));
+    this->weapon_cache_ =
+        Weapon::Make(mainhand_item, const_cast<PlayerEx*>(this));
   } else {
-    return std::shared_ptr<Weapon>();  // empty pointer
+    this->weapon_cache_.reset();  // empty pointer
   }
+
+  this->weapon_cache_item_ = mainhand_item;
+  this->is_weapon_cache_valid_ = true;
+
+  return this->weapon_cache_;
 }
 
 const std::string& PlayerEx::GetXUID() const { return this->xuid_; }
@@ -272,6 +352,9 @@ void PlayerEx::GiveItem(const std::string& identifier, int value) {
 
   auto item = ItemStack::create(identifier, value);
   this->GetPlayer()->giveItem(item);
+
+  // The slots changed by giving items are unknown
+  this->is_item_count_valid_ = false;
 }
 
 void PlayerEx::IncreaseHP(int value) {
@@ -279,9 +362,26 @@ void PlayerEx::IncreaseHP(int value) {
 }
 
 void PlayerEx::IncreaseStamina(int value) {
-  this->stamina_ += value;
-  this->stamina_ = std::max(this->stamina_, 0);
-  this->stamina_ = std::min(this->stamina_, this->stamina_max_);
+  this->stamina_ = std::clamp(
+      this->GetStaminaMilli() + value * stamina::kScale, 0,
+      this->stamina_max_ * stamina::kScale);
+  this->stamina_tick_ = GetNowTick();
+}
+
+void PlayerEx::InvalidateArtifacts() const {
+  this->is_artifact_summary_valid_ = false;
+
+  this->InvalidateStats();
+}
+
+void PlayerEx::InvalidateStats() const {
+  for (const auto& character : this->character_owned_) {
+    character->InvalidateStats();
+  }
+}
+
+void PlayerEx::InvalidateWeapon() const {
+  this->is_weapon_cache_valid_ = false;
 }
 
 bool PlayerEx::IsOpeningContainer() const {
@@ -291,13 +391,13 @@ bool PlayerEx::IsOpeningContainer() const {
 bool PlayerEx::IsPlayer() const { return true; }
 
 void PlayerEx::RefreshItems() const {
-  auto xuid = this->xuid_;
-  // Refresh next tick to ensure that the data of the items are updated
-  Schedule::nextTick([xuid]() {
-    if (PlayerEx::Get(xuid)) {  // ensure that the player is online
-      PlayerEx::Get(xuid)->GetPlayer()->refreshInventory();
-    }
-  });
+  // The items may be modified, e.g. weapons or artifacts enhanced
+  this->InvalidateArtifacts();
+
+  // Defer the refresh to the end of the tick to ensure that the data of the
+  // items are updated, and to merge the requests in the same tick
+  this->is_items_refresh_pending_ = true;
+  ++PlayerEx::items_refresh_request_count_;
 }
 
 void PlayerEx::SelectCharacter(int no) {
@@ -320,39 +420,81 @@ void PlayerEx::SetLastNativeHealth(int health) {
   throw ExceptionMethodNotAllowed();
 }
 
+void PlayerEx::UpdateItemCount(int slot, const ItemStack* item) const {
+  // Nothing to do if the histogram will be rebuilt anyway
+  if (!this->is_item_count_valid_) {
+    return;
+  }
+
+  // Fall back to a full scan if the slot is not in the inventory
+  if (slot < 0 || slot >= this->item_slot_list_.size()) {
+    this->is_item_count_valid_ = false;
+    return;
+  }
+
+  auto& [id, count] = this->item_slot_list_[slot];
+
+  // Remove the previous item in the slot
+  if (id >= 0) {
+    this->item_count_list_[id] -= count;
+  }
+
+  if (item == nullptr || item->isNull()) {
+    id = -1;
+    count = 0;
+    return;
+  }
+
+  // Add the new item in the slot
+  id = PlayerEx::GetItemID(item->getTypeName());
+  count = item->getCount();
+
+  if (id >= this->item_count_list_.size()) {
+    this->item_count_list_.resize(id + 1, 0);
+  }
+  this->item_count_list_[id] += count;
+}
+
 std::shared_ptr<PlayerEx> PlayerEx::Get(long long unique_id) {
-  auto player = Global<Level>->getPlayer(ActorUniqueID(unique_id));
+  auto iter = PlayerEx::all_playerex_by_unique_id_.find(unique_id);
 
-  if (player == nullptr) {
+  if (iter == PlayerEx::all_playerex_by_unique_id_.end()) {  // if not found
     return std::shared_ptr<PlayerEx>();
   }
 
-  return PlayerEx::Get(player->getXuid());
+  return iter->second;
 }
 
 std::shared_ptr<PlayerEx> PlayerEx::Get(const std::string& xuid) {
-  auto pred = [xuid](const std::shared_ptr<PlayerEx>& playerex) {
-    return (playerex->GetXUID() == xuid);
-  };  // the predicate
-  auto iter = std::find_if(PlayerEx::all_playerex_.begin(),
-                           PlayerEx::all_playerex_.end(), pred);
+  auto iter = PlayerEx::all_playerex_by_xuid_.find(xuid);
 
-  if (iter == PlayerEx::all_playerex_.end()) {  // if not found
+  if (iter == PlayerEx::all_playerex_by_xuid_.end()) {  // if not found
     return std::shared_ptr<PlayerEx>();
   }
 
-  return *iter;
+  return iter->second;
 }
 
 std::vector<std::shared_ptr<PlayerEx>>& PlayerEx::GetAll() {
   return PlayerEx::all_playerex_;
 }
 
+long long PlayerEx::GetDeferredTickJobCount() {
+  return PlayerEx::tick_job_deferred_count_;
+}
+
+long long PlayerEx::GetSavedItemsRefreshCount() {
+  return PlayerEx::items_refresh_request_count_ -
+         PlayerEx::items_refresh_count_;
+}
+
 void PlayerEx::LoadPlayer(Player* player) {
   if (!PlayerEx::Get(player->getXuid())) {  // to prevent duplicated load
     auto playerex = std::make_shared<PlayerEx>(player);
     playerex->LoadData();
     PlayerEx::all_playerex_.push_back(playerex);
+    PlayerEx::all_playerex_by_unique_id_[playerex->GetUniqueID()] = playerex;
+    PlayerEx::all_playerex_by_xuid_[playerex->GetXUID()] = playerex;
   }
 }
 
@@ -365,132 +507,62 @@ void PlayerEx::OnPlayerRespawn(Player* player) {
 }
 
 void PlayerEx::OnTick() {
-  static std::default_random_engine random_engine;
-  static std::uniform_real_distribution<> dist(0, 1);
-
-  for (auto&& playerex : PlayerEx::all_playerex_) {
-    // Maintain the world level notice
-    int world_level =
-        world::GetWorldLevel(playerex->GetPlayer()->getPosition(),
-                             playerex->GetPlayer()->getDimension());
-    if (world_level != playerex->last_world_level_) {
-      if (world_level * 11 - 10 > playerex->GetLevel() + 10) {
-        playerex->GetPlayer()->sendTitlePacket("§cHighly Dangerous",
-                                               TitleType::SetSubtitle, 0, 1, 0);
-      } else if (world_level * 11 - 10 > playerex->GetLevel()) {
-        playerex->GetPlayer()->sendTitlePacket("§6Dangerous",
-                                               TitleType::SetSubtitle, 0, 1, 0);
-      }
-
-      playerex->GetPlayer()->sendTitlePacket(
-          "World Level " + std::to_string(world_level), TitleType::SetTitle, 0,
-          1, 0);
-
-      playerex->last_world_level_ = world_level;
-    }
-
-    // Maintain the stamina
-    if (playerex->GetPlayer()->isSprinting() &&
-        !playerex->GetPlayer()->isSwimming()) {
-      // Prevent sprinting if the stamina is used up
-      if (playerex->stamina_ == 0) {
-        playerex->GetPlayer()->setSprinting(false);
-      }
-
-      // Reduce 18 stamina per second when sprinting
-      if (dist(random_engine) < 0.9) {
-        playerex->IncreaseStamina(-1);
-      }
-
-    } else if (playerex->GetPlayer()->isSwimming()) {
-      // The player drowns if the stamina is used up
-      if (playerex->stamina_ == 0) {
-        world::HurtActor(playerex->GetPlayer(), 999999., ActorDamageCause::Override);
-      }
-
-      // Reduce 10.2 stamina per second when swimming dash
-      if (dist(random_engine) < 0.51) {
-        playerex->IncreaseStamina(-1);
-      }
-
-    } else if (playerex->GetPlayer()->isInWater() &&
-               !playerex->GetPlayer()->isOnGround() &&
-               playerex->GetPlayer()->isMoving()) {
-      // The player drowns if the stamina is used up
-      if (playerex->stamina_ == 0) {
-        world::HurtActor(playerex->GetPlayer(), 999999., ActorDamageCause::Override);
-      }
-
-      // Reduce 4 stamina per second when swimming
-      if (dist(random_engine) < 0.51) {
-        playerex->IncreaseStamina(-1);
-      }
-
-    } else if (playerex->GetPlayer()->isInWater() &&
-               !playerex->GetPlayer()->isOnGround()) {
-      // The player drowns if the stamina is used up
-      if (playerex->stamina_ == 0) {
-        world::HurtActor(playerex->GetPlayer(), 999999., ActorDamageCause::Override);
-      }
-    } else {
-      // Regenerate stamina when idle
-      // Regenerate 25 stamina per second when idle and on ground
-      if (dist(random_engine) < 0.25) {
-        playerex->IncreaseStamina(2);
-      } else {
-        playerex->IncreaseStamina(1);
+  auto start_clock = std::chrono::steady_clock::now();
+
+  // Run the upkeep jobs. A job of a player runs when the staggered slot of
+  // the player comes, and deferrable jobs slip to later ticks once the tick
+  // budget is used up. The iteration starts from a rotating player so that
+  // the deferred work is not always left to the same players.
+  auto now_tick = GetNowTick();
+  auto player_count = static_cast<long long>(PlayerEx::all_playerex_.size());
+  for (long long i = 0; i < player_count; ++i) {
+    auto playerex = PlayerEx::all_playerex_[(now_tick + i) % player_count];
+
+    for (int j = 0; j < PlayerEx::kTickJobCount; ++j) {
+      const auto& job = PlayerEx::kTickJobList[j];
+      auto last_tick = playerex->tick_job_last_tick_list_[j];
+
+      if ((now_tick + playerex->tick_offset_) / job.interval ==
+          (last_tick + playerex->tick_offset_) / job.interval) {
+        continue;  // no slot has come since the last run
       }
-    }
 
-    // Maintain the character survival
-    if (playerex->character_->GetHP() ==
-        0) {  // if the current character is dead
-      playerex->character_->IncreaseEnergy(-999999);  // Clear the energy
-
-      bool is_switched = false;
-      for (auto&& character : playerex->character_owned_) {
-        // Switch to the first character alive
-        if (character->GetHP() != 0) {
-          playerex->character_ = character;
-        }
+      if (job.is_deferrable &&
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - start_clock)
+                  .count() >= PlayerEx::kTickBudget) {
+        ++PlayerEx::tick_job_deferred_count_;
+        continue;
       }
-      if (!is_switched) {  // if every character is dead
-        world::HurtActor(playerex->GetPlayer(), 999999., ActorDamageCause::Override);
-      }
-    }
 
-    // Maintain the character fullness
-    for (auto character : playerex->character_owned_) {
-      character->IncreaseFullness(-0.015);
+      profiler::ScopedTimer timer(job.phase);
+      ((*playerex).*job.function)();
+      playerex->tick_job_last_tick_list_[j] = now_tick;
     }
+  }
 
-    // Maintain the native health
-    if (playerex->GetPlayer()->getHealth() <
-        playerex->GetPlayer()
-            ->getMaxHealth()) {  // if the player loses health abnormally
-      playerex->GetPlayer()->heal(20);
-    }
+  // Resend the inventories requested in this tick. This is done after all
+  // other maintenance so that the requests made by it are covered as well.
+  profiler::ScopedTimer timer(profiler::Phase::kTickItemsRefresh);
 
-    // Maintain the wither effect (temporary, for this is just a bug of
-    // Minecraft)
-    if (playerex->GetPlayer()->hasEffect(*MobEffect::WITHER)) {
-      world::HurtActor(playerex->GetPlayer(), 1., ActorDamageCause::Wither);
+  for (auto&& playerex : PlayerEx::all_playerex_) {
+    if (playerex->is_items_refresh_pending_) {
+      playerex->GetPlayer()->refreshInventory();
+      playerex->is_items_refresh_pending_ = false;
+      ++PlayerEx::items_refresh_count_;
     }
-
-    // Refresh the sidebar
-    playerex->sidebar_.Refresh();
   }
 }
 
 void PlayerEx::UnloadPlayer(Player* player) {
-  if (PlayerEx::Get(player->getXuid())) {  // to prevent duplicated unload
+  auto playerex = PlayerEx::Get(player->getXuid());
+  if (playerex) {  // to prevent duplicated unload
+    PlayerEx::all_playerex_by_unique_id_.erase(playerex->GetUniqueID());
+    PlayerEx::all_playerex_by_xuid_.erase(playerex->GetXUID());
+
     auto& all_playerex = PlayerEx::GetAll();
-    for (auto it = all_playerex.begin(); it != all_playerex.end(); ++it) {
-      if ((*it)->GetXUID() == player->getXuid()) {
-        all_playerex.erase(it);
-        break;
-      }
-    }
+    all_playerex.erase(
+        std::find(all_playerex.begin(), all_playerex.end(), playerex));
   }
 }
 
@@ -514,19 +586,24 @@ const nlohmann::json PlayerEx::kPlayerDataTemplate = R"(
   }
 )"_json;
 
-void PlayerEx::LoadData() {
-  auto players_db = KVDB::open("plugins/GenshiCraft/db/players");
+std::vector<ItemStack*> PlayerEx::GetArtifactItemList() const {
+  auto player = this->GetPlayer();
+  return {player->getArmorContainer().getSlot(0),
+          player->getArmorContainer().getSlot(1),
+          player->getArmorContainer().getSlot(2),
+          player->getArmorContainer().getSlot(3),
+          const_cast<ItemStack*>(&(player->getOffhandSlot()))};
+}
 
-  nlohmann::json data;
+int PlayerEx::GetStaminaMilli() const {
+  return stamina::Advance(this->stamina_, this->stamina_rate_,
+                          GetNowTick() - this->stamina_tick_,
+                          this->stamina_max_ * stamina::kScale);
+}
 
+void PlayerEx::LoadData() {
   // Attempt to get the data from the database
-  std::string data_str;
-  players_db->get(this->xuid_, data_str);
-  try {
-    data = nlohmann::json::parse(data_str);
-  } catch (const nlohmann::json::parse_error&) {
-    // Empty
-  }
+  auto data = database::GetPlayerData(this->xuid_);
 
   // Migrate the data and check its validity
   data = PlayerEx::MigrateData(data);
@@ -535,7 +612,7 @@ void PlayerEx::LoadData() {
     data = PlayerEx::kPlayerDataTemplate;
 
     // Save the data
-    players_db->set(this->xuid_, data.dump());
+    database::SetPlayerData(this->xuid_, data);
   }
 
   // Load the data
@@ -566,7 +643,37 @@ void PlayerEx::LoadData() {
     }
   }
   this->stamina_max_ = data["stamina_max"].get<int>();
-  this->stamina_ = this->stamina_max_;
+  this->stamina_ = this->stamina_max_ * stamina::kScale;
+  this->stamina_tick_ = GetNowTick();
+}
+
+void PlayerEx::RebuildArtifactSummary() const {
+  this->artifact_summary_ = Artifact::Summary();
+
+  for (const auto& [type, view] : this->GetArtifactViewDict()) {
+    this->artifact_summary_.base_stats += Artifact::GetBaseStats(view);
+    ++this->artifact_summary_.set_count_list[view.info->set_id];
+  }
+
+  auto offhand_item =
+      const_cast<ItemStack*>(&(this->GetPlayer()->getOffhandSlot()));
+  this->offhand_artifact_view_ = (Artifact::CheckIsArtifact(offhand_item))
+                                     ? Artifact::MakeView(offhand_item)
+                                     : Artifact::View();
+
+  this->is_artifact_summary_valid_ = true;
+}
+
+void PlayerEx::RebuildItemCount() const {
+  auto& inventory = this->GetPlayer()->getInventory();
+
+  this->item_count_list_.assign(this->item_count_list_.size(), 0);
+  this->item_slot_list_.assign(inventory.getSize(), {-1, 0});
+  this->is_item_count_valid_ = true;
+
+  for (int i = 0; i < inventory.getSize(); ++i) {
+    this->UpdateItemCount(i, inventory.getSlot(i));
+  }
 }
 
 void PlayerEx::SaveData() {
@@ -576,8 +683,6 @@ void PlayerEx::SaveData() {
 
   this->is_data_saved_ = true;
 
-  auto players_db = KVDB::open("plugins/GenshiCraft/db/players");
-
   nlohmann::json data;
   data["version"] = PlayerEx::kPlayerExDataFormatVersion;
   data["character"] = this->GetCharacter()->GetName();
@@ -602,7 +707,118 @@ void PlayerEx::SaveData() {
 
   data["stamina_max"] = this->stamina_max_;
 
-  players_db->set(this->xuid_, data.dump());
+  // The data is serialized and written in the background
+  database::SetPlayerData(this->xuid_, std::move(data));
+}
+
+void PlayerEx::SetStaminaRate(int rate) {
+  if (rate == this->stamina_rate_) {
+    return;
+  }
+
+  this->stamina_ = this->GetStaminaMilli();
+  this->stamina_tick_ = GetNowTick();
+  this->stamina_rate_ = rate;
+}
+
+void PlayerEx::TickArtifacts() {
+  if (!this->is_artifact_summary_valid_) {
+    return;  // the summary will be rebuilt when read
+  }
+
+  // No event reports the changes of the offhand slot, so compare the offhand
+  // artifact with the one when the summary was built
+  auto offhand_item =
+      const_cast<ItemStack*>(&(this->GetPlayer()->getOffhandSlot()));
+  auto offhand_artifact_view = (Artifact::CheckIsArtifact(offhand_item))
+                                   ? Artifact::MakeView(offhand_item)
+                                   : Artifact::View();
+
+  if (!(offhand_artifact_view == this->offhand_artifact_view_)) {
+    this->InvalidateArtifacts();
+  }
+}
+
+void PlayerEx::TickCharacterSurvival() {
+  if (this->character_->GetHP() == 0) {  // if the current character is dead
+    this->character_->IncreaseEnergy(-999999);  // Clear the energy
+
+    bool is_switched = false;
+    for (auto&& character : this->character_owned_) {
+      // Switch to the first character alive
+      if (character->GetHP() != 0) {
+        this->character_ = character;
+      }
+    }
+    if (!is_switched) {  // if every character is dead
+      world::HurtActor(this->GetPlayer(), 999999., ActorDamageCause::Override);
+    }
+  }
+}
+
+void PlayerEx::TickItemCount() {
+  if (!this->is_item_count_valid_) {
+    return;  // the counts will be rebuilt when read
+  }
+
+  // Check the item count histograms against a full inventory scan in case
+  // that some inventory changes were not reported by any event
+  auto item_slot_list = this->item_slot_list_;
+  this->RebuildItemCount();
+  if (this->item_slot_list_ != item_slot_list) {
+    logger.warn("The item counts of player {} were out of sync.",
+                this->GetXUID());
+  }
+}
+
+void PlayerEx::TickNativeHealth() {
+  // The native health is lost only abnormally
+  if (this->GetPlayer()->getHealth() < this->GetPlayer()->getMaxHealth()) {
+    this->GetPlayer()->heal(20);
+  }
+}
+
+void PlayerEx::TickSidebar() {
+  this->sidebar_.Refresh();
+}
+
+void PlayerEx::TickStamina() {
+  // The stamina is only evaluated when read, so only the rate is updated here
+  auto state = stamina::GetState(this->GetPlayer());
+
+  if (this->GetStaminaMilli() == 0) {
+    stamina::OnExhausted(this->GetPlayer(), state);
+  }
+
+  this->SetStaminaRate(stamina::GetRate(state));
+}
+
+void PlayerEx::TickWither() {
+  // The wither effect is a bug of Minecraft and this is temporary
+  if (this->GetPlayer()->hasEffect(*MobEffect::WITHER)) {
+    world::HurtActor(this->GetPlayer(), 1., ActorDamageCause::Wither);
+  }
+}
+
+void PlayerEx::TickWorldLevel() {
+  int world_level =
+      world::GetWorldLevel(this->GetPlayer()->getPosition(),
+                           this->GetPlayer()->getDimension());
+  if (world_level != this->last_world_level_) {
+    if (world_level * 11 - 10 > this->GetLevel() + 10) {
+      this->GetPlayer()->sendTitlePacket(
+          "§cHighly Dangerous", TitleType::SetSubtitle, 0, 1, 0);
+    } else if (world_level * 11 - 10 > this->GetLevel()) {
+      this->GetPlayer()->sendTitlePacket("§6Dangerous", TitleType::SetSubtitle,
+                                         0, 1, 0);
+    }
+
+    this->GetPlayer()->sendTitlePacket(
+        "World Level " + std::to_string(world_level), TitleType::SetTitle, 0, 1,
+        0);
+
+    this->last_world_level_ = world_level;
+  }
 }
 
 nlohmann::json PlayerEx::MigrateData(const nlohmann::json& old_data) {
@@ -638,6 +854,46 @@ nlohmann::json PlayerEx::MigrateData(const nlohmann::json& old_data) {
   return data;
 }
 
+int PlayerEx::GetItemID(const std::string& identifier) {
+  auto iter = PlayerEx::item_id_dict_.find(identifier);
+  if (iter != PlayerEx::item_id_dict_.end()) {
+    return iter->second;
+  }
+
+  int id = static_cast<int>(PlayerEx::item_id_dict_.size());
+  PlayerEx::item_id_dict_[identifier] = id;
+  return id;
+}
+
+const PlayerEx::TickJob PlayerEx::kTickJobList[PlayerEx::kTickJobCount] = {
+    {&PlayerEx::TickWorldLevel, 10, true, profiler::Phase::kTickWorldLevel},
+    {&PlayerEx::TickStamina, 1, false, profiler::Phase::kTickStamina},
+    {&PlayerEx::TickCharacterSurvival, 1, false,
+     profiler::Phase::kTickCharacterSurvival},
+    {&PlayerEx::TickNativeHealth, 1, false, profiler::Phase::kTickNativeHealth},
+    {&PlayerEx::TickWither, 1, false, profiler::Phase::kTickWither},
+    {&PlayerEx::TickSidebar, 4, true, profiler::Phase::kTickSidebar},
+    {&PlayerEx::TickArtifacts, 20, true, profiler::Phase::kTickArtifacts},
+    {&PlayerEx::TickItemCount, PlayerEx::kItemCountCheckInterval, true,
+     profiler::Phase::kTickItemCountCheck},
+};
+
 std::vector<std::shared_ptr<PlayerEx>> PlayerEx::all_playerex_ = {};
 
+std::unordered_map<long long, std::shared_ptr<PlayerEx>>
+    PlayerEx::all_playerex_by_unique_id_ = {};
+
+std::unordered_map<std::string, std::shared_ptr<PlayerEx>>
+    PlayerEx::all_playerex_by_xuid_ = {};
+
+std::unordered_map<std::string, int> PlayerEx::item_id_dict_ = {};
+
+long long PlayerEx::items_refresh_count_ = 0;
+
+long long PlayerEx::items_refresh_request_count_ = 0;
+
+int PlayerEx::next_tick_offset_ = 0;
+
+long long PlayerEx::tick_job_deferred_count_ = 0;
+
 }  // namespace genshicraft
\ No newline at end of file
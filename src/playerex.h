@@ -31,11 +31,14 @@
 #ifndef GENSHICRAFT_PLAYEREX_H_
 #define GENSHICRAFT_PLAYEREX_H_
 
+#include <MC/ItemStack.hpp>
 #include <MC/Player.hpp>
 #include <map>
 #include <memory>
 #include <string>
 #include <third-party/Nlohmann/json.hpp>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "artifact.h"
@@ -43,6 +46,7 @@
 #include "damage.h"
 #include "menu.h"
 #include "mobex.h"
+#include "profiler.h"
 #include "sidebar.h"
 #include "stats.h"
 #include "weapon.h"
@@ -90,6 +94,16 @@ class PlayerEx final : public MobEx {
    */
   void ConsumeItem(std::string identifier, int value);
 
+  /**
+   * @brief Consume several types of items in one inventory pass
+   *
+   * @param item_dict The numbers to consume indexed by the identifiers
+   *
+   * @exception ExceptionItemsNotEnough The number of some items are fewer than
+   * the number to consume.
+   */
+  void ConsumeItems(const std::map<std::string, int>& item_dict);
+
   /**
    * @brief Consume mora
    *
@@ -114,6 +128,28 @@ class PlayerEx final : public MobEx {
    */
   std::map<Artifact::Type, std::shared_ptr<Artifact>> GetArtifactDict() const;
 
+  /**
+   * @brief Get the summary of the artifacts
+   *
+   * @return The summary
+   *
+   * @note The summary is cached until PlayerEx::InvalidateArtifacts() is
+   * called, which happens when the armor slots change or the items are
+   * refreshed. The offhand slot is checked every second since no event
+   * reports its changes.
+   */
+  const Artifact::Summary& GetArtifactSummary() const;
+
+  /**
+   * @brief Get the read-only views of the artifacts
+   *
+   * @return The views
+   *
+   * @note Unlike PlayerEx::GetArtifactDict(), this method has no side effect
+   * on the artifact items.
+   */
+  std::map<Artifact::Type, Artifact::View> GetArtifactViewDict() const;
+
   /**
    * @brief Get the attack damage
    *
@@ -139,10 +175,13 @@ class PlayerEx final : public MobEx {
   int GetHP() const override;
 
   /**
-   * @brief Get the number of a type of items
+   * @brief Get the number of a type of items in the inventory
    *
    * @param identifier The identifier of the items
    * @return The number
+   *
+   * @note The number is read from the item count histogram, which is rebuilt
+   * by a full inventory scan only if it has been invalidated.
    */
   int GetItemCount(std::string identifier) const;
 
@@ -181,10 +220,20 @@ class PlayerEx final : public MobEx {
    */
   Player* GetPlayer() const;
 
+  /**
+   * @brief Get the sidebar handler
+   *
+   * @return The sidebar handler
+   */
+  const Sidebar& GetSidebar() const;
+
   /**
    * @brief Get the stamina
    *
    * @return The stamina
+   *
+   * @note The stamina changes linearly with ticks at the rate of the movement
+   * state and is only evaluated when read or changed.
    */
   int GetStamina() const;
 
@@ -206,6 +255,9 @@ class PlayerEx final : public MobEx {
    * @brief Get the Weapon object
    *
    * @return A pointer to the weapon
+   *
+   * @note The Weapon object is cached until the held slot changes or
+   * PlayerEx::InvalidateWeapon() is called.
    */
   std::shared_ptr<Weapon> GetWeapon() const;
 
@@ -238,6 +290,28 @@ class PlayerEx final : public MobEx {
    */
   void IncreaseStamina(int value);
 
+  /**
+   * @brief Invalidate the cached artifact summary and the cached stats of all
+   * characters
+   *
+   * @note This method should be called whenever the artifacts change.
+   */
+  void InvalidateArtifacts() const;
+
+  /**
+   * @brief Invalidate the cached stats of all characters
+   *
+   * @note This method should be called whenever the equipment changes.
+   */
+  void InvalidateStats() const;
+
+  /**
+   * @brief Invalidate the cached Weapon object
+   *
+   * @note This method should be called whenever the inventory changes.
+   */
+  void InvalidateWeapon() const;
+
   /**
    * @brief Check if the player is opening a container
    *
@@ -255,6 +329,8 @@ class PlayerEx final : public MobEx {
   /**
    * @brief Refresh items in the inventory
    *
+   * @note The inventory is resent at most once per tick in PlayerEx::OnTick(),
+   * however many times this method is called.
    */
   void RefreshItems() const;
 
@@ -287,6 +363,16 @@ class PlayerEx final : public MobEx {
    */
   void SetLastNativeHealth(int health) override;
 
+  /**
+   * @brief Update the item count histogram with a changed inventory slot
+   *
+   * @param slot The slot number
+   * @param item The new item in the slot
+   *
+   * @note This method should be called whenever an inventory slot changes.
+   */
+  void UpdateItemCount(int slot, const ItemStack* item) const;
+
   /**
    * @brief Get a PlayerEx object by a unique ID
    *
@@ -314,6 +400,21 @@ class PlayerEx final : public MobEx {
    */
   static std::vector<std::shared_ptr<PlayerEx>>& GetAll();
 
+  /**
+   * @brief Get the number of upkeep job runs deferred for the tick budget
+   *
+   * @return The number of times that a due upkeep job slipped to a later tick
+   */
+  static long long GetDeferredTickJobCount();
+
+  /**
+   * @brief Get the number of inventory resyncs saved by coalescing
+   *
+   * @return The number of PlayerEx::RefreshItems() calls that did not cause an
+   * extra inventory resync
+   */
+  static long long GetSavedItemsRefreshCount();
+
   /**
    * @brief Load a player
    *
@@ -342,11 +443,47 @@ class PlayerEx final : public MobEx {
   static void UnloadPlayer(Player* player);
 
  private:
+  /**
+   * @brief The TickJob struct describes a per-player upkeep job run by
+   * PlayerEx::OnTick().
+   *
+   */
+  struct TickJob {
+    void (PlayerEx::*function)();  // the job
+    int interval;                  // the interval in ticks between two slots
+    bool is_deferrable;            // true if the job can slip to a later tick
+    profiler::Phase phase;         // the phase to profile the job
+  };
+
+  inline static const int kItemCountCheckInterval =
+      100;  // the interval in ticks between two consistency checks of the item
+            // count histograms
   inline static const int kPlayerExDataFormatVersion = 1;
+  inline static const int kTickBudget =
+      5000;  // the time budget in microseconds per tick, after which the
+             // deferrable upkeep jobs slip to later ticks
+  inline static const int kTickJobCount = 8;
+
+  static const TickJob
+      kTickJobList[kTickJobCount];  // the upkeep jobs in order of running
 
   static const nlohmann::json
       kPlayerDataTemplate;  // the player data template for new players
 
+  /**
+   * @brief Get the items in the slots where artifacts take effect
+   *
+   * @return The items in the armor slots and the offhand slot
+   */
+  std::vector<ItemStack*> GetArtifactItemList() const;
+
+  /**
+   * @brief Get the stamina in sub-units
+   *
+   * @return The stamina in sub-units
+   */
+  int GetStaminaMilli() const;
+
   /**
    * @brief Load the data
    *
@@ -354,6 +491,18 @@ class PlayerEx final : public MobEx {
    */
   void LoadData() override;
 
+  /**
+   * @brief Rebuild the artifact summary from the equipped artifacts
+   *
+   */
+  void RebuildArtifactSummary() const;
+
+  /**
+   * @brief Rebuild the item count histogram by a full inventory scan
+   *
+   */
+  void RebuildItemCount() const;
+
   /**
    * @brief Save the data
    *
@@ -361,6 +510,53 @@ class PlayerEx final : public MobEx {
    */
   void SaveData() override;
 
+  /**
+   * @brief Set the stamina change rate
+   *
+   * @param rate The stamina change per tick in sub-units
+   */
+  void SetStaminaRate(int rate);
+
+  /**
+   * @brief Invalidate the artifact summary if the offhand artifact changes
+   */
+  void TickArtifacts();
+
+  /**
+   * @brief Switch to another character if the current one is dead
+   */
+  void TickCharacterSurvival();
+
+  /**
+   * @brief Check the item count histograms against a full inventory scan
+   */
+  void TickItemCount();
+
+  /**
+   * @brief Keep the native health full
+   */
+  void TickNativeHealth();
+
+  /**
+   * @brief Refresh the sidebar
+   */
+  void TickSidebar();
+
+  /**
+   * @brief Consume or regenerate the stamina by the movement
+   */
+  void TickStamina();
+
+  /**
+   * @brief Apply the wither effect
+   */
+  void TickWither();
+
+  /**
+   * @brief Notify the player when the world level changes
+   */
+  void TickWorldLevel();
+
   /**
    * @brief Migrate the data with previous data format version to current
    * version.
@@ -372,19 +568,65 @@ class PlayerEx final : public MobEx {
    */
   static nlohmann::json MigrateData(const nlohmann::json& old_data);
 
+  /**
+   * @brief Get the interned ID of an item identifier
+   *
+   * @param identifier The identifier of the item
+   * @return The interned ID, which is assigned on the first call
+   */
+  static int GetItemID(const std::string& identifier);
+
+  mutable Artifact::Summary
+      artifact_summary_;  // the cached summary of the equipped artifacts
   std::shared_ptr<Character> character_;  // a pointer to the current character
   std::vector<std::shared_ptr<Character>>
       character_owned_;        // all characters owned
+  mutable std::vector<int>
+      item_count_list_;  // the item counts indexed by the interned item IDs
+  mutable std::vector<std::pair<int, int>>
+      item_slot_list_;  // the interned item ID and the count in each slot
+  mutable bool is_artifact_summary_valid_;  // false if the artifact summary
+                                           // needs rebuilding
+  mutable bool
+      is_item_count_valid_;  // false if the item counts need rebuilding
+  mutable bool is_items_refresh_pending_;  // true if the inventory should be
+                                          // resent at the end of the tick
   bool is_opening_container_;  // true if the player is opening a container
-  int last_world_level_;       // the world level last tick
+  mutable bool
+      is_weapon_cache_valid_;  // false if the weapon cache needs rebuilding
+  int last_world_level_;       // the world level at the last check
   Menu menu_;                  // the menu handler for the player
+  mutable Artifact::View
+      offhand_artifact_view_;  // the offhand artifact when the summary was
+                               // built, whose info is null if there was none
   Sidebar sidebar_;            // the sidebar handler for the player
-  int stamina_;                // the stamina
+  int stamina_;                // the stamina in sub-units at stamina_tick_
   int stamina_max_;            // the max value of the stamina
-  std::string xuid_;           // the XUID
+  int stamina_rate_;           // the stamina change per tick in sub-units
+  long long stamina_tick_;     // the tick when stamina_ was evaluated
+  long long tick_job_last_tick_list_
+      [kTickJobCount];  // the tick of the last run of each upkeep job
+  int tick_offset_;     // the offset to stagger the upkeep job slots
+  mutable std::shared_ptr<Weapon>
+      weapon_cache_;  // the cached Weapon object of the held item
+  mutable const ItemStack*
+      weapon_cache_item_;  // the held item when the weapon was cached
+  std::string xuid_;       // the XUID
 
   static std::vector<std::shared_ptr<PlayerEx>>
       all_playerex_;  // All PlayerEx objects
+  static std::unordered_map<long long, std::shared_ptr<PlayerEx>>
+      all_playerex_by_unique_id_;  // all PlayerEx objects indexed by unique ID
+  static std::unordered_map<std::string, std::shared_ptr<PlayerEx>>
+      all_playerex_by_xuid_;  // all PlayerEx objects indexed by XUID
+  static std::unordered_map<std::string, int>
+      item_id_dict_;  // the interned IDs of the item identifiers
+  static long long
+      items_refresh_count_;  // the number of inventory resyncs performed
+  static long long items_refresh_request_count_;  // the number of calls to
+                                                  // PlayerEx::RefreshItems()
+  static int next_tick_offset_;  // the stagger offset of the next player
+  static long long tick_job_deferred_count_;  // the number of deferred runs
 };
 
 }  // namespace genshicraft
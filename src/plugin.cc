@@ -57,10 +57,13 @@
 #include "character.h"
 #include "command.h"
 #include "damage.h"
+#include "database.h"
 #include "exceptions.h"
 #include "food.h"
+#include "item.h"
 #include "mobex.h"
 #include "playerex.h"
+#include "profiler.h"
 #include "stats.h"
 #include "version.h"
 #include "weapon.h"
@@ -70,6 +73,26 @@ namespace genshicraft {
 
 Logger logger(PLUGIN_NAME);
 
+namespace {
+
+double now_clock = 0.;   // the clocks captured at the start of this tick
+long long now_tick = 0;  // the number of ticks since the plugin was loaded
+
+/**
+ * @brief Read the clocks in seconds from the steady clock
+ *
+ * @return The clocks
+ */
+double ReadClock() {
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::milliseconds>(
+                 std::chrono::steady_clock::now().time_since_epoch())
+                 .count()) /
+         1000;
+}
+
+}  // namespace
+
 void CheckProtocolVersion() {
 #ifdef TARGET_BDS_PROTOCOL_VERSION
   auto currentProtocol = LL::getServerProtocolVersion();
@@ -84,19 +107,26 @@ void CheckProtocolVersion() {
 #endif  // TARGET_BDS_PROTOCOL_VERSION
 }
 
-double GetNowClock() {
-  return static_cast<double>(
-             std::chrono::duration_cast<std::chrono::milliseconds>(
-                 std::chrono::steady_clock::now().time_since_epoch())
-                 .count()) /
-         1000;
-}
+double GetNowClock() { return now_clock; }
+
+long long GetNowTick() { return now_tick; }
 
 void Init() {
+  now_clock = ReadClock();
+
   CheckProtocolVersion();
 
+  // The tags written by a broken build would be unreadable by later builds
+  if (!ActorEx::CheckDataRecords() || !MobEx::CheckDataRecords()) {
+    logger.error("The self-test of the actor data records failed.");
+  }
+
+  database::Init();
+
   Command::Init();
 
+  Event::ArmorSetEvent::subscribe_ref(OnArmorSet);
+  Event::MobDieEvent::subscribe_ref(OnMobDie);
   Event::MobHurtEvent::subscribe_ref(OnMobHurt);
   Event::PlayerDropItemEvent::subscribe_ref(OnPlayerDropItem);
   Event::PlayerExperienceAddEvent::subscribe_ref(OnPlayerExperienceAdd);
@@ -108,11 +138,33 @@ void Init() {
       OnPlayerOpenContainerScreen);
   Event::PlayerRespawnEvent::subscribe_ref(OnPlayerRespawn);
   Event::PlayerUseItemEvent::subscribe_ref(OnPlayerUseItem);
+  Event::ServerStoppedEvent::subscribe_ref(OnServerStopped);
 
   Schedule::repeat(OnTick, 1);
 }
 
+bool OnArmorSet(Event::ArmorSetEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnArmorSet);
+
+  auto playerex = PlayerEx::Get(event.mPlayer->getXuid());
+  if (playerex) {  // the event may be triggered before the player is loaded
+    playerex->InvalidateArtifacts();
+  }
+
+  return true;
+}
+
+bool OnMobDie(Event::MobDieEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnMobDie);
+
+  MobEx::UnloadMob(event.mMob);
+
+  return true;
+}
+
 bool OnMobHurt(Event::MobHurtEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnMobHurt);
+
   static const std::map<world::ElementType, std::string> kElementTypeColor = {
       {world::ElementType::kAnemo, "§3"},
       {world::ElementType::kCryo, "§b"},
@@ -290,6 +342,8 @@ bool OnMobHurt(Event::MobHurtEvent& event) {
 }
 
 bool OnPlayerDropItem(Event::PlayerDropItemEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnPlayerDropItem);
+
   // Prevent keeping inventory
   if (event.mPlayer->getHealth() == 0) {
     return true;
@@ -313,6 +367,8 @@ bool OnPlayerDropItem(Event::PlayerDropItemEvent& event) {
 }
 
 bool OnPlayerExperienceAdd(Event::PlayerExperienceAddEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnPlayerExperienceAdd);
+
   auto playerex = PlayerEx::Get(event.mPlayer->getXuid());
   playerex->GetCharacter()->IncreaseEnergy(event.mExp);
 
@@ -320,45 +376,66 @@ bool OnPlayerExperienceAdd(Event::PlayerExperienceAddEvent& event) {
 }
 
 bool OnPlayerRespawn(Event::PlayerRespawnEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnPlayerRespawn);
+
   PlayerEx::OnPlayerRespawn(event.mPlayer);
 
   return true;
 }
 
 bool OnPlayerInventoryChange(Event::PlayerInventoryChangeEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnPlayerInventoryChange);
+
   auto playerex = PlayerEx::Get(event.mPlayer->getXuid());
   if (!playerex) {  // if the player is not loaded
     return true;
   }
 
-  if (Weapon::CheckIsWeapon(event.mNewItemStack)) {
-    Weapon::Make(event.mNewItemStack, playerex.get());
-  }
+  // The held item may change
+  playerex->InvalidateStats();
+  playerex->InvalidateWeapon();
 
-  if (Artifact::CheckIsArtifact(event.mNewItemStack)) {
-    Artifact::Make(event.mNewItemStack, playerex.get());
-  }
+  playerex->UpdateItemCount(event.mSlot, event.mNewItemStack);
 
-  if (food::CheckIsFood(event.mNewItemStack)) {
-    food::RegisterFood(playerex.get(), event.mNewItemStack);
+  switch (item::Classify(event.mNewItemStack).kind) {
+    case item::Kind::kArtifact:
+      Artifact::Make(event.mNewItemStack, playerex.get());
+      break;
+
+    case item::Kind::kFood:
+      food::RegisterFood(playerex.get(), event.mNewItemStack);
+      break;
+
+    case item::Kind::kWeapon:
+      Weapon::Make(event.mNewItemStack, playerex.get());
+      break;
+
+    default:
+      break;
   }
 
   return true;
 }
 
 bool OnPlayerJoin(Event::PlayerJoinEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnPlayerJoin);
+
   PlayerEx::LoadPlayer(event.mPlayer);
 
   return true;
 }
 
 bool OnPlayerLeft(Event::PlayerLeftEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnPlayerLeft);
+
   PlayerEx::UnloadPlayer(event.mPlayer);
 
   return true;
 }
 
 bool OnPlayerOpenContainer(Event::PlayerOpenContainerEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnPlayerOpenContainer);
+
   auto playerex = PlayerEx::Get(event.mPlayer->getXuid());
   playerex->SetIsOpeningContainer(true);
 
@@ -366,6 +443,8 @@ bool OnPlayerOpenContainer(Event::PlayerOpenContainerEvent& event) {
 }
 
 bool OnPlayerOpenContainerScreen(Event::PlayerOpenContainerScreenEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnPlayerOpenContainerScreen);
+
   auto playerex = PlayerEx::Get(event.mPlayer->getXuid());
   if (!playerex->IsOpeningContainer() &&
       !playerex->GetPlayer()->isSneaking()) {  // if the player is pressing E
@@ -382,6 +461,8 @@ bool OnPlayerOpenContainerScreen(Event::PlayerOpenContainerScreenEvent& event) {
 }
 
 bool OnPlayerUseItem(Event::PlayerUseItemEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnPlayerUseItem);
+
   if (food::CheckIsFood(event.mItemStack)) {
     auto playerex = PlayerEx::Get(event.mPlayer->getXuid());
 
@@ -391,6 +472,28 @@ bool OnPlayerUseItem(Event::PlayerUseItemEvent& event) {
   return true;
 }
 
-void OnTick() { PlayerEx::OnTick(); }
+bool OnServerStopped(Event::ServerStoppedEvent& event) {
+  profiler::ScopedTimer timer(profiler::Phase::kOnServerStopped);
+
+  MobEx::UnloadAll();
+
+  database::Close();  // the data saved afterwards is written synchronously
+
+  return true;
+}
+
+void OnTick() {
+  ++now_tick;
+  now_clock = ReadClock();
+
+  {
+    profiler::ScopedTimer timer(profiler::Phase::kTickMobEx);
+    MobEx::OnTick();
+  }
+
+  PlayerEx::OnTick();
+
+  profiler::OnTick();
+}
 
 }  // namespace genshicraft
\ No newline at end of file
@@ -57,9 +57,35 @@ void Init();
  * @brief Get the clocks in seconds
  *
  * @return The clocks
+ *
+ * @note The clocks are captured once at the start of each tick, so all
+ * systems see the same time within a tick.
  */
 double GetNowClock();
 
+/**
+ * @brief Get the number of ticks since the plugin was loaded
+ *
+ * @return The ticks
+ */
+long long GetNowTick();
+
+/**
+ * @brief The handler for ArmorSetEvent
+ *
+ * @param event The event
+ * @return Always true
+ */
+bool OnArmorSet(Event::ArmorSetEvent& event);
+
+/**
+ * @brief The handler for MobDieEvent
+ *
+ * @param event The event
+ * @return Always true
+ */
+bool OnMobDie(Event::MobDieEvent& event);
+
 /**
  * @brief The handler for MobHurtEvent
  *
@@ -140,12 +166,22 @@ bool OnPlayerRespawn(Event::PlayerRespawnEvent& event);
  */
 bool OnPlayerUseItem(Event::PlayerUseItemEvent& event);
 
+/**
+ * @brief The handler for ServerStoppedEvent
+ *
+ * @param event The event
+ * @return Always true
+ */
+bool OnServerStopped(Event::ServerStoppedEvent& event);
+
 /**
  * @brief This function executes per tick.
  *
  */
 void OnTick();
 
+inline const int kTicksPerSecond = 20;  // the game ticks per second
+
 extern Logger logger;  // The logger
 
 }  // namespace genshicraft
@@ -0,0 +1,213 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file profiler.cc
+ * @author Futrime (futrime@outlook.com)
+ * @brief Definition of profiler interfaces
+ * @version 1.0.0
+ * @date 2022-08-20
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#include "profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "plugin.h"
+
+namespace genshicraft {
+
+namespace profiler {
+
+namespace {
+
+const int kBucketCount =
+    40;  // the number of histogram buckets, where bucket i holds the
+         // durations in [2^i, 2^(i+1)) nanoseconds
+const char kLogPath[] =
+    "plugins/GenshiCraft/logs/perf.log";  // the path of the log file
+const int kPhaseCount =
+    static_cast<int>(Phase::kOnServerStopped) + 1;  // the number of phases
+
+const char* kPhaseNameList[kPhaseCount] = {
+    "PlayerEx::OnTick/world level",
+    "PlayerEx::OnTick/stamina",
+    "PlayerEx::OnTick/character survival",
+    "PlayerEx::OnTick/native health",
+    "PlayerEx::OnTick/wither",
+    "PlayerEx::OnTick/sidebar",
+    "PlayerEx::OnTick/artifacts",
+    "PlayerEx::OnTick/item count check",
+    "PlayerEx::OnTick/items refresh",
+    "MobEx::OnTick",
+    "OnArmorSet",
+    "OnMobDie",
+    "OnMobHurt",
+    "OnPlayerDropItem",
+    "OnPlayerExperienceAdd",
+    "OnPlayerInventoryChange",
+    "OnPlayerJoin",
+    "OnPlayerLeft",
+    "OnPlayerOpenContainer",
+    "OnPlayerOpenContainerScreen",
+    "OnPlayerRespawn",
+    "OnPlayerUseItem",
+    "OnServerStopped"};  // the names of the phases
+
+/**
+ * @brief The latency histogram of a phase
+ *
+ */
+struct Histogram {
+  long long bucket_list[kBucketCount] = {};  // the counts of the buckets
+  long long count = 0;                       // the number of records
+  long long max = 0;  // the max duration in nanoseconds
+};
+
+Histogram histogram_list[kPhaseCount];  // the histograms of the phases
+
+int dump_interval = 0;        // the dump interval in seconds, 0 if disabled
+double last_dump_clock = 0.;  // the clock of the last dump
+
+/**
+ * @brief Get a percentile of a histogram
+ *
+ * @param histogram The histogram
+ * @param percentile The percentile (0 ~ 1)
+ * @return The upper bound of the bucket holding the percentile, no more than
+ * the max, in nanoseconds
+ */
+long long GetPercentile(const Histogram& histogram, double percentile) {
+  auto target = static_cast<long long>(std::ceil(histogram.count * percentile));
+  target = std::max(target, 1LL);
+
+  long long cumulative_count = 0;
+  for (int i = 0; i < kBucketCount; ++i) {
+    cumulative_count += histogram.bucket_list[i];
+    if (cumulative_count >= target) {
+      return std::min(1LL << (i + 1), histogram.max);
+    }
+  }
+
+  return histogram.max;
+}
+
+}  // namespace
+
+ScopedTimer::ScopedTimer(Phase phase)
+    : phase_(phase), start_(std::chrono::steady_clock::now()) {
+  // Empty
+}
+
+ScopedTimer::~ScopedTimer() {
+  Record(this->phase_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - this->start_)
+                           .count());
+}
+
+std::vector<std::string> GetReport() {
+  std::vector<std::string> report;
+
+  for (int i = 0; i < kPhaseCount; ++i) {
+    const auto& histogram = histogram_list[i];
+    if (histogram.count == 0) {
+      continue;
+    }
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << kPhaseNameList[i]
+        << ": n=" << histogram.count
+        << " p50=" << GetPercentile(histogram, 0.5) / 1000. << "us"
+        << " p99=" << GetPercentile(histogram, 0.99) / 1000. << "us"
+        << " max=" << histogram.max / 1000. << "us";
+    report.push_back(oss.str());
+  }
+
+  return report;
+}
+
+void OnTick() {
+  if (dump_interval <= 0) {
+    return;
+  }
+
+  auto now_clock = GetNowClock();
+  if (now_clock - last_dump_clock < dump_interval) {
+    return;
+  }
+  last_dump_clock = now_clock;
+
+  std::error_code error_code;
+  std::filesystem::create_directories(
+      std::filesystem::path(kLogPath).parent_path(), error_code);
+
+  std::ofstream log_file(kLogPath, std::ios::app);
+  if (!log_file) {
+    logger.error("Failed to open {}.", kLogPath);
+    return;
+  }
+
+  auto now_time = std::time(nullptr);
+  log_file << "[" << std::put_time(std::localtime(&now_time), "%F %T")
+           << "]\n";
+  for (const auto& line : GetReport()) {
+    log_file << line << "\n";
+  }
+}
+
+void Record(Phase phase, long long duration) {
+  auto& histogram = histogram_list[static_cast<int>(phase)];
+
+  // Find the bucket by the highest bit of the duration
+  int bucket = 0;
+  while (bucket < kBucketCount - 1 && (duration >> (bucket + 1)) > 0) {
+    ++bucket;
+  }
+
+  ++histogram.bucket_list[bucket];
+  ++histogram.count;
+  histogram.max = std::max(histogram.max, duration);
+}
+
+void Reset() {
+  for (auto& histogram : histogram_list) {
+    histogram = Histogram();
+  }
+}
+
+void SetDumpInterval(int interval) {
+  dump_interval = std::max(interval, 0);
+  last_dump_clock = GetNowClock();
+}
+
+}  // namespace profiler
+
+}  // namespace genshicraft
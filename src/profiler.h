@@ -0,0 +1,148 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file profiler.h
+ * @author Futrime (futrime@outlook.com)
+ * @brief Declaration of profiler interfaces
+ * @version 1.0.0
+ * @date 2022-08-20
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#ifndef GENSHICRAFT_PROFILER_H_
+#define GENSHICRAFT_PROFILER_H_
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace genshicraft {
+
+namespace profiler {
+
+/**
+ * @brief The profiled phases
+ *
+ */
+enum class Phase {
+  // The phases of PlayerEx::OnTick()
+  kTickWorldLevel = 0,
+  kTickStamina,
+  kTickCharacterSurvival,
+  kTickNativeHealth,
+  kTickWither,
+  kTickSidebar,
+  kTickArtifacts,
+  kTickItemCountCheck,
+  kTickItemsRefresh,
+
+  // The other tick tasks
+  kTickMobEx,
+
+  // The event handlers
+  kOnArmorSet,
+  kOnMobDie,
+  kOnMobHurt,
+  kOnPlayerDropItem,
+  kOnPlayerExperienceAdd,
+  kOnPlayerInventoryChange,
+  kOnPlayerJoin,
+  kOnPlayerLeft,
+  kOnPlayerOpenContainer,
+  kOnPlayerOpenContainerScreen,
+  kOnPlayerRespawn,
+  kOnPlayerUseItem,
+  kOnServerStopped
+};
+
+/**
+ * @brief The ScopedTimer class records the time from its construction to its
+ * destruction to the histogram of a phase.
+ *
+ */
+class ScopedTimer {
+ public:
+  ScopedTimer() = delete;
+
+  /**
+   * @brief Construct a new ScopedTimer object and start timing
+   *
+   * @param phase The phase to time
+   */
+  explicit ScopedTimer(Phase phase);
+
+  ScopedTimer(const ScopedTimer&) = delete;
+
+  /**
+   * @brief Destroy the ScopedTimer object and record the time
+   *
+   */
+  ~ScopedTimer();
+
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+ private:
+  Phase phase_;                                  // the phase to time
+  std::chrono::steady_clock::time_point start_;  // the time of construction
+};
+
+/**
+ * @brief Get the report of all phases
+ *
+ * @return The lines of the report, one for each phase ever recorded, with the
+ * count, the p50, the p99 and the max in microseconds
+ */
+std::vector<std::string> GetReport();
+
+/**
+ * @brief Dump the report to the log file if it is time to
+ *
+ * @note This function should execute per tick.
+ */
+void OnTick();
+
+/**
+ * @brief Record a duration of a phase
+ *
+ * @param phase The phase
+ * @param duration The duration in nanoseconds
+ */
+void Record(Phase phase, long long duration);
+
+/**
+ * @brief Clear all histograms
+ *
+ */
+void Reset();
+
+/**
+ * @brief Set the interval of dumping the report to the log file
+ *
+ * @param interval The interval in seconds, or 0 to disable dumping
+ */
+void SetDumpInterval(int interval);
+
+}  // namespace profiler
+
+}  // namespace genshicraft
+
+#endif  // GENSHICRAFT_PROFILER_H_
@@ -32,6 +32,7 @@
 
 #include <MC/Player.hpp>
 #include <MC/Types.hpp>
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <utility>
@@ -42,101 +43,156 @@
 
 namespace genshicraft {
 
-Sidebar::Sidebar(PlayerEx* playerex) : playerex_(playerex) {
+Sidebar::Sidebar(PlayerEx* playerex)
+    : is_sent_(false),
+      last_character_(nullptr),
+      last_has_weapon_(false),
+      last_progress_bar_list_(),
+      packet_count_(0),
+      packet_count_start_clock_(0.),
+      packet_rate_(0),
+      playerex_(playerex) {
   // Empty
 }
 
+int Sidebar::GetPacketRate() const { return this->packet_rate_; }
+
 void Sidebar::Refresh() {
-  std::vector<std::pair<std::string, int>> content;
+  static const char* kRowNameList[Sidebar::kRowCount] = {
+      "Stamina ", "HP ", "Fullness ", "Skill CD ", "Burst CD ", "Energy "};
 
-  // Character name
-  auto character_name =
-      std::string((this->playerex_->GetCharacter()->HasWeapon()) ? "§f"
-                                                                 : "§c") +
-      this->playerex_->GetCharacter()->GetName();
+  auto character = this->playerex_->GetCharacter();
 
   // Stamina
   auto stamina_progress = static_cast<double>(this->playerex_->GetStamina()) /
                           this->playerex_->GetStaminaMax();
-  content.push_back(
-      {"Stamina " + Sidebar::GenerateProgressBar(
-                        stamina_progress, this->playerex_->GetStaminaMax() / 10,
-                        (stamina_progress < 0.3)
-                            ? "§c"
-                            : ((stamina_progress > 0.999) ? "§a" : "§e")),
-       0});
 
   // HP
-  auto HP_progress =
-      static_cast<double>(this->playerex_->GetCharacter()->GetHP()) /
-      this->playerex_->GetCharacter()->GetStats().GetMaxHP();
-  content.push_back(
-      {"HP " + Sidebar::GenerateProgressBar(HP_progress, 36,
-                                            (HP_progress < 0.3) ? "§c" : "§a"),
-       1});
+  auto HP_progress = static_cast<double>(character->GetHP()) /
+                     character->GetStats().GetMaxHP();
 
   // Fullness
-  auto fullness_progress =
-      std::min(this->playerex_->GetCharacter()->GetFullness(), 100.) / 100.;
-  content.push_back(
-      {"Fullness " + Sidebar::GenerateProgressBar(
-                         fullness_progress, 21,
-                         (fullness_progress < 0.75)
-                             ? "§a"
-                             : ((fullness_progress > 0.999) ? "§c" : "§e")),
-       2});
+  auto fullness_progress = std::min(character->GetFullness(), 100.) / 100.;
 
   // Elemental Skill CD
   auto elemental_skill_CD_progress =
-      1 - static_cast<double>(
-              this->playerex_->GetCharacter()->GetCDElementalSkill()) /
-              this->playerex_->GetCharacter()->GetCDElementalSkillMax();
-  content.push_back(
-      {"Skill CD " + Sidebar::GenerateProgressBar(
-                         elemental_skill_CD_progress, 24,
-                         (elemental_skill_CD_progress > 0.999) ? "§a" : "§e"),
-       3});
+      1 - static_cast<double>(character->GetCDElementalSkill()) /
+              character->GetCDElementalSkillMax();
 
   // Elemental Burst CD
   auto elemental_burst_CD_progress =
-      1 - static_cast<double>(
-              this->playerex_->GetCharacter()->GetCDElementalBurst()) /
-              this->playerex_->GetCharacter()->GetCDElementalBurstMax();
-  content.push_back(
-      {"Burst CD " + Sidebar::GenerateProgressBar(
-                         elemental_burst_CD_progress, 20,
-                         (elemental_burst_CD_progress > 0.999) ? "§a" : "§e"),
-       4});
+      1 - static_cast<double>(character->GetCDElementalBurst()) /
+              character->GetCDElementalBurstMax();
 
   // Elemental Burst Energy
   auto elemental_burst_energy_progress =
-      static_cast<double>(this->playerex_->GetCharacter()->GetEnergy()) /
-      this->playerex_->GetCharacter()->GetEnergyMax();
-  content.push_back(
-      {"Energy " + Sidebar::GenerateProgressBar(
-                       elemental_burst_energy_progress, 24,
-                       (elemental_burst_energy_progress > 0.999) ? "§a" : "§e"),
-       5});
+      static_cast<double>(character->GetEnergy()) / character->GetEnergyMax();
+
+  const ProgressBar progress_bar_list[Sidebar::kRowCount] = {
+      Sidebar::QuantizeProgressBar(
+          stamina_progress, this->playerex_->GetStaminaMax() / 10,
+          (stamina_progress < 0.3)
+              ? "§c"
+              : ((stamina_progress > 0.999) ? "§a" : "§e")),
+      Sidebar::QuantizeProgressBar(HP_progress, 36,
+                                   (HP_progress < 0.3) ? "§c" : "§a"),
+      Sidebar::QuantizeProgressBar(
+          fullness_progress, 21,
+          (fullness_progress < 0.75)
+              ? "§a"
+              : ((fullness_progress > 0.999) ? "§c" : "§e")),
+      Sidebar::QuantizeProgressBar(
+          elemental_skill_CD_progress, 24,
+          (elemental_skill_CD_progress > 0.999) ? "§a" : "§e"),
+      Sidebar::QuantizeProgressBar(
+          elemental_burst_CD_progress, 20,
+          (elemental_burst_CD_progress > 0.999) ? "§a" : "§e"),
+      Sidebar::QuantizeProgressBar(
+          elemental_burst_energy_progress, 24,
+          (elemental_burst_energy_progress > 0.999) ? "§a" : "§e")};
+
+  auto has_weapon = character->HasWeapon();
+
+  // Roll the packet counter over every second
+  auto now_clock = GetNowClock();
+  if (now_clock - this->packet_count_start_clock_ >= 1.) {
+    this->packet_rate_ = this->packet_count_;
+    this->packet_count_ = 0;
+    this->packet_count_start_clock_ = now_clock;
+  }
+
+  // Nothing to send if nothing visible changes. Only the quantized states are
+  // compared, so no string is built on this path.
+  if (this->is_sent_ && character.get() == this->last_character_ &&
+      has_weapon == this->last_has_weapon_ &&
+      std::equal(progress_bar_list, progress_bar_list + Sidebar::kRowCount,
+                 this->last_progress_bar_list_)) {
+    return;
+  }
+
+  // Render the sidebar from the precomputed progress bars
+  auto character_name =
+      std::string(has_weapon ? "§f" : "§c") + character->GetName();
+
+  std::vector<std::pair<std::string, int>> content;
+  content.reserve(Sidebar::kRowCount);
+  for (int i = 0; i < Sidebar::kRowCount; ++i) {
+    const auto& progress_bar = progress_bar_list[i];
 
+    std::string row = kRowNameList[i];
+    row += progress_bar.formatting_codes;
+    row += Sidebar::kProgressBarTable[progress_bar.steps]
+                                     [progress_bar.filled_steps];
+
+    content.push_back({std::move(row), i});
+  }
+
+  // The sidebar API does not support updating single rows, so the whole
+  // sidebar is resent
   auto player = this->playerex_->GetPlayer();
   player->removeSidebar();
   player->setSidebar(character_name, content, ObjectiveSortOrder::Ascending);
+  this->packet_count_ += Sidebar::kPacketsPerUpdate;
+
+  this->is_sent_ = true;
+  this->last_character_ = character.get();
+  this->last_has_weapon_ = has_weapon;
+  std::copy(progress_bar_list, progress_bar_list + Sidebar::kRowCount,
+            this->last_progress_bar_list_);
 }
 
-std::string Sidebar::GenerateProgressBar(double value, int steps,
-                                         std::string formatting_codes) {
-  auto filled_steps = static_cast<int>(value * steps);
+bool Sidebar::ProgressBar::operator==(const ProgressBar& other) const {
+  return this->filled_steps == other.filled_steps &&
+         this->steps == other.steps &&
+         this->formatting_codes == other.formatting_codes;
+}
 
-  std::string progress_bar = formatting_codes;
-  for (int i = 0; i < steps; ++i) {
-    if (i < filled_steps) {
-      progress_bar += "|";
-    } else {
-      progress_bar += ".";
-    }
+Sidebar::ProgressBar Sidebar::QuantizeProgressBar(
+    double value, int steps, const char* formatting_codes) {
+  steps = std::max(steps, 0);
+  steps = std::min(steps, Sidebar::kMaxProgressBarSteps);
+
+  // Compare in a way that also handles NaN values, e.g. when a max is zero
+  int filled_steps = 0;
+  if (value >= 1.) {
+    filled_steps = steps;
+  } else if (value > 0.) {
+    filled_steps = static_cast<int>(value * steps);
   }
 
-  return progress_bar;
+  return {formatting_codes, filled_steps, steps};
 }
 
+const std::vector<std::vector<std::string>> Sidebar::kProgressBarTable = []() {
+  std::vector<std::vector<std::string>> table(Sidebar::kMaxProgressBarSteps +
+                                              1);
+  for (int steps = 0; steps <= Sidebar::kMaxProgressBarSteps; ++steps) {
+    for (int filled_steps = 0; filled_steps <= steps; ++filled_steps) {
+      table[steps].push_back(std::string(filled_steps, '|') +
+                             std::string(steps - filled_steps, '.'));
+    }
+  }
+  return table;
+}();
+
 }  // namespace genshicraft
@@ -31,11 +31,13 @@
 #ifndef GENSHICRAFT_SIDEBAR_H_
 #define GENSHICRAFT_SIDEBAR_H_
 
-#include <string>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace genshicraft {
 
+class Character;
 class PlayerEx;
 
 /**
@@ -53,24 +55,65 @@ class Sidebar {
 
   Sidebar() = delete;
 
+  /**
+   * @brief Get the number of packets sent for the sidebar in the last second
+   *
+   * @return The number of packets
+   */
+  int GetPacketRate() const;
+
   /**
    * @brief Refresh the sidebar
    *
+   * @note The sidebar is only resent if the rendered content changes. The
+   * progress bars are quantized to their steps, so changes too small to move
+   * a bar do not cause resending.
    */
   void Refresh();
 
  private:
   /**
-   * @brief Generate a text progress bar
+   * @brief The quantized state of a text progress bar
+   *
+   */
+  struct ProgressBar {
+    const char* formatting_codes;  // the formatting codes
+    int filled_steps;              // the number of filled steps
+    int steps;                     // the number of steps
+
+    bool operator==(const ProgressBar& other) const;
+  };
+
+  inline static const int kMaxProgressBarSteps =
+      64;  // the maximum steps of a progress bar
+  inline static const int kPacketsPerUpdate =
+      3;  // the packets sent by an update: one to remove the old sidebar, and
+          // two to display the objective and to set the scores
+  inline static const int kRowCount = 6;  // the number of rows
+
+  static const std::vector<std::vector<std::string>>
+      kProgressBarTable;  // [A][B] means the text progress bar of A steps with
+                          // B steps filled, built at startup
+
+  /**
+   * @brief Quantize a text progress bar
    *
    * @param value The value of the progress bar (0 ~ 1)
-   * @param steps The steps of the progress bar (eight steps per chraracter)
-   * @param format_code The formatting codes
-   * @return The text progress bar
+   * @param steps The steps of the progress bar
+   * @param formatting_codes The formatting codes
+   * @return The quantized progress bar
    */
-  static std::string GenerateProgressBar(double value, int steps = 10,
-                                         std::string formatting_codes = "");
+  static ProgressBar QuantizeProgressBar(double value, int steps,
+                                         const char* formatting_codes);
 
+  bool is_sent_;  // true if the sidebar has been sent
+  const Character* last_character_;  // the character shown last time
+  bool last_has_weapon_;  // true if the character had a weapon last time
+  ProgressBar last_progress_bar_list_[kRowCount];  // the progress bars sent
+                                                    // last time
+  int packet_count_;                 // the packets sent in this second
+  double packet_count_start_clock_;  // the clock when this second started
+  int packet_rate_;                  // the packets sent in the last second
   PlayerEx* playerex_;
 };
 
@@ -0,0 +1,173 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file stamina.cc
+ * @author Futrime (futrime@outlook.com)
+ * @brief Definition of stamina interfaces
+ * @version 1.0.0
+ * @date 2022-08-21
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#include "stamina.h"
+
+#include <MC/Actor.hpp>
+#include <MC/ActorDamageSource.hpp>
+#include <MC/Player.hpp>
+#include <MC/Types.hpp>
+
+#include "plugin.h"
+#include "world.h"
+
+namespace genshicraft {
+
+namespace stamina {
+
+namespace {
+
+/**
+ * @brief The effects of using up the stamina
+ *
+ */
+enum class ExhaustionEffect { kNone = 0, kDrown, kStopGliding, kStopSprinting };
+
+/**
+ * @brief The StateInfo struct describes how a state changes the stamina.
+ *
+ */
+struct StateInfo {
+  int rate;                            // the change per second in sub-units
+  ExhaustionEffect exhaustion_effect;  // the effect when used up
+};
+
+constexpr int kStateCount =
+    static_cast<int>(State::kGlide) + 1;  // the number of states
+
+// The states are indexed by stamina::State
+constexpr StateInfo kStateInfoList[kStateCount] = {
+    {25000, ExhaustionEffect::kNone},            // idle
+    {-18000, ExhaustionEffect::kStopSprinting},  // sprint
+    {-10200, ExhaustionEffect::kDrown},          // swim
+    {-10200, ExhaustionEffect::kDrown},          // swim dash
+    {0, ExhaustionEffect::kDrown},               // tread water
+    {-2500, ExhaustionEffect::kStopGliding}};    // glide
+
+/**
+ * @brief Get the stamina change rate of a state
+ *
+ * @param state The state
+ * @return The stamina change per tick in sub-units
+ */
+constexpr int GetRatePerTick(State state) {
+  return kStateInfoList[static_cast<int>(state)].rate / kTicksPerSecond;
+}
+
+/**
+ * @brief Check if the rates of all states are whole sub-units per tick, i.e.
+ * the per-tick rates add up to exactly the per-second rates
+ *
+ * @return True if the rates are exact
+ */
+constexpr bool CheckRatesExact() {
+  for (int i = 0; i < kStateCount; ++i) {
+    if (GetRatePerTick(static_cast<State>(i)) * kTicksPerSecond !=
+        kStateInfoList[i].rate) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(CheckRatesExact(),
+              "The stamina rates must be whole sub-units per tick");
+
+constexpr int kTestMaxValue = 240 * kScale;  // the maximum stamina in tests
+
+// Draining over N ticks is exact
+static_assert(Advance(kTestMaxValue, GetRatePerTick(State::kSprint),
+                      kTicksPerSecond, kTestMaxValue) == kTestMaxValue - 18000,
+              "Sprinting for a second must drain exactly 18 stamina");
+static_assert(Advance(kTestMaxValue, GetRatePerTick(State::kSwim),
+                      5 * kTicksPerSecond, kTestMaxValue) ==
+                  kTestMaxValue - 51000,
+              "Swimming for 5 seconds must drain exactly 51 stamina");
+static_assert(Advance(kTestMaxValue, GetRatePerTick(State::kGlide), 7,
+                      kTestMaxValue) == kTestMaxValue - 7 * 125,
+              "Gliding for 7 ticks must drain exactly 875 sub-units");
+static_assert(Advance(kTestMaxValue / 2, GetRatePerTick(State::kTreadWater),
+                      1000, kTestMaxValue) == kTestMaxValue / 2,
+              "Treading water must keep the stamina");
+
+// The stamina is clamped to [0, max]
+static_assert(Advance(10000, GetRatePerTick(State::kSprint), 1000000,
+                      kTestMaxValue) == 0,
+              "The stamina must not drop below 0");
+static_assert(Advance(0, GetRatePerTick(State::kIdle), 1000000,
+                      kTestMaxValue) == kTestMaxValue,
+              "The stamina must not exceed the maximum");
+
+}  // namespace
+
+int GetRate(State state) { return GetRatePerTick(state); }
+
+State GetState(Player* player) {
+  if (player->getStatusFlag(ActorFlags::GLIDING)) {
+    return State::kGlide;
+  }
+
+  if (player->isSprinting() && !player->isSwimming()) {
+    return State::kSprint;
+  }
+
+  if (player->isSwimming()) {
+    return State::kSwimDash;
+  }
+
+  if (player->isInWater() && !player->isOnGround()) {
+    return (player->isMoving()) ? State::kSwim : State::kTreadWater;
+  }
+
+  return State::kIdle;
+}
+
+void OnExhausted(Player* player, State state) {
+  switch (kStateInfoList[static_cast<int>(state)].exhaustion_effect) {
+    case ExhaustionEffect::kDrown:
+      world::HurtActor(player, 999999., ActorDamageCause::Override);
+      break;
+
+    case ExhaustionEffect::kStopGliding:
+      player->setStatusFlag(ActorFlags::GLIDING, false);
+      break;
+
+    case ExhaustionEffect::kStopSprinting:
+      player->setSprinting(false);
+      break;
+
+    default:
+      break;
+  }
+}
+
+}  // namespace stamina
+
+}  // namespace genshicraft
@@ -0,0 +1,101 @@
+/**
+ *    GenshiCraft. Play Genshin Impact in Minecraft!
+ *    Copyright (C) 2022  Futrime <futrime@outlook.com>
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU Affero General Public License as published
+ *    by the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file stamina.h
+ * @author Futrime (futrime@outlook.com)
+ * @brief Declaration of stamina interfaces
+ * @version 1.0.0
+ * @date 2022-08-21
+ *
+ * @copyright Copyright (c) 2022 Futrime
+ *
+ */
+
+#ifndef GENSHICRAFT_STAMINA_H_
+#define GENSHICRAFT_STAMINA_H_
+
+#include <MC/Player.hpp>
+#include <algorithm>
+
+namespace genshicraft {
+
+namespace stamina {
+
+/**
+ * @brief The movement states that change the stamina
+ *
+ */
+enum class State {
+  kIdle = 0,
+  kSprint,
+  kSwim,
+  kSwimDash,
+  kTreadWater,
+  kGlide
+};
+
+inline const int kScale = 1000;  // the sub-units per stamina
+
+/**
+ * @brief Advance the stamina by ticks at a rate
+ *
+ * @param value The stamina in sub-units
+ * @param rate The stamina change per tick in sub-units
+ * @param elapsed_ticks The ticks elapsed
+ * @param max_value The maximum stamina in sub-units
+ * @return The stamina in sub-units after the ticks, clamped to [0, max_value]
+ */
+constexpr int Advance(int value, int rate, long long elapsed_ticks,
+                      int max_value) {
+  return static_cast<int>(
+      std::clamp(value + static_cast<long long>(rate) * elapsed_ticks, 0LL,
+                 static_cast<long long>(max_value)));
+}
+
+/**
+ * @brief Get the stamina change rate of a state
+ *
+ * @param state The state
+ * @return The stamina change per tick in sub-units, which is exact
+ */
+int GetRate(State state);
+
+/**
+ * @brief Get the movement state of a player
+ *
+ * @param player The player
+ * @return The state
+ */
+State GetState(Player* player);
+
+/**
+ * @brief Apply the effect of using up the stamina in a state, e.g. drowning
+ * when swimming
+ *
+ * @param player The player
+ * @param state The state
+ */
+void OnExhausted(Player* player, State state);
+
+}  // namespace stamina
+
+}  // namespace genshicraft
+
+#endif  // GENSHICRAFT_STAMINA_H_
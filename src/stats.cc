@@ -32,6 +32,279 @@
 
 namespace genshicraft {
 
+namespace {
+
+constexpr int kElementCount = 8;  // the length of the element-indexed arrays
+
+static_assert(sizeof(Stats::DMG_bonus) == sizeof(double) * kElementCount &&
+                  sizeof(Stats::RES) == sizeof(double) * kElementCount,
+              "The element-indexed arrays must match kElementCount");
+
+/**
+ * @brief Add stats to other stats field by field
+ *
+ * @param stats The stats to add to
+ * @param other The stats to add
+ */
+constexpr void AddStats(Stats* stats, const Stats& other) {
+  stats->max_HP_base += other.max_HP_base;
+  stats->max_HP_ext += other.max_HP_ext;
+  stats->max_HP_percent += other.max_HP_percent;
+  stats->ATK_base += other.ATK_base;
+  stats->ATK_ext += other.ATK_ext;
+  stats->ATK_percent += other.ATK_percent;
+  stats->DEF_base += other.DEF_base;
+  stats->DEF_ext += other.DEF_ext;
+  stats->DEF_percent += other.DEF_percent;
+  stats->elemental_mastery += other.elemental_mastery;
+  stats->max_stamina += other.max_stamina;
+
+  stats->CRIT_rate += other.CRIT_rate;
+  stats->CRIT_DMG += other.CRIT_DMG;
+  stats->healing_bonus += other.healing_bonus;
+  stats->incoming_healing_bonus += other.incoming_healing_bonus;
+  stats->energy_recharge += other.energy_recharge;
+  stats->CD_reduction += other.CD_reduction;
+  stats->shield_strength += other.shield_strength;
+
+  for (int i = 0; i < kElementCount; ++i) {
+    stats->DMG_bonus[i] += other.DMG_bonus[i];
+    stats->RES[i] += other.RES[i];
+  }
+}
+
+/**
+ * @brief Multiply stats by a factor field by field
+ *
+ * @param stats The stats to scale
+ * @param factor The factor
+ *
+ * @note The integer stats are truncated after scaling.
+ */
+constexpr void ScaleStats(Stats* stats, double factor) {
+  stats->max_HP_base = static_cast<int>(stats->max_HP_base * factor);
+  stats->max_HP_ext = static_cast<int>(stats->max_HP_ext * factor);
+  stats->max_HP_percent *= factor;
+  stats->ATK_base = static_cast<int>(stats->ATK_base * factor);
+  stats->ATK_ext = static_cast<int>(stats->ATK_ext * factor);
+  stats->ATK_percent *= factor;
+  stats->DEF_base = static_cast<int>(stats->DEF_base * factor);
+  stats->DEF_ext = static_cast<int>(stats->DEF_ext * factor);
+  stats->DEF_percent *= factor;
+  stats->elemental_mastery =
+      static_cast<int>(stats->elemental_mastery * factor);
+  stats->max_stamina = static_cast<int>(stats->max_stamina * factor);
+
+  stats->CRIT_rate *= factor;
+  stats->CRIT_DMG *= factor;
+  stats->healing_bonus *= factor;
+  stats->incoming_healing_bonus *= factor;
+  stats->energy_recharge *= factor;
+  stats->CD_reduction *= factor;
+  stats->shield_strength *= factor;
+
+  for (int i = 0; i < kElementCount; ++i) {
+    stats->DMG_bonus[i] *= factor;
+    stats->RES[i] *= factor;
+  }
+}
+
+/**
+ * @brief Subtract stats from other stats field by field
+ *
+ * @param stats The stats to subtract from
+ * @param other The stats to subtract
+ */
+constexpr void SubtractStats(Stats* stats, const Stats& other) {
+  stats->max_HP_base -= other.max_HP_base;
+  stats->max_HP_ext -= other.max_HP_ext;
+  stats->max_HP_percent -= other.max_HP_percent;
+  stats->ATK_base -= other.ATK_base;
+  stats->ATK_ext -= other.ATK_ext;
+  stats->ATK_percent -= other.ATK_percent;
+  stats->DEF_base -= other.DEF_base;
+  stats->DEF_ext -= other.DEF_ext;
+  stats->DEF_percent -= other.DEF_percent;
+  stats->elemental_mastery -= other.elemental_mastery;
+  stats->max_stamina -= other.max_stamina;
+
+  stats->CRIT_rate -= other.CRIT_rate;
+  stats->CRIT_DMG -= other.CRIT_DMG;
+  stats->healing_bonus -= other.healing_bonus;
+  stats->incoming_healing_bonus -= other.incoming_healing_bonus;
+  stats->energy_recharge -= other.energy_recharge;
+  stats->CD_reduction -= other.CD_reduction;
+  stats->shield_strength -= other.shield_strength;
+
+  for (int i = 0; i < kElementCount; ++i) {
+    stats->DMG_bonus[i] -= other.DMG_bonus[i];
+    stats->RES[i] -= other.RES[i];
+  }
+}
+
+/**
+ * @brief Make stats whose fields all hold distinct values for the checks
+ * below
+ *
+ * @param seed The value of the first field
+ * @return The stats
+ */
+constexpr Stats MakeCheckStats(int seed) {
+  Stats stats;
+  stats.max_HP_base = seed + 0;
+  stats.max_HP_ext = seed + 1;
+  stats.max_HP_percent = seed + 2 + 0.5;
+  stats.ATK_base = seed + 3;
+  stats.ATK_ext = seed + 4;
+  stats.ATK_percent = seed + 5 + 0.5;
+  stats.DEF_base = seed + 6;
+  stats.DEF_ext = seed + 7;
+  stats.DEF_percent = seed + 8 + 0.5;
+  stats.elemental_mastery = seed + 9;
+  stats.max_stamina = seed + 10;
+  stats.CRIT_rate = seed + 11 + 0.5;
+  stats.CRIT_DMG = seed + 12 + 0.5;
+  stats.healing_bonus = seed + 13 + 0.5;
+  stats.incoming_healing_bonus = seed + 14 + 0.5;
+  stats.energy_recharge = seed + 15 + 0.5;
+  stats.CD_reduction = seed + 16 + 0.5;
+  stats.shield_strength = seed + 17 + 0.5;
+
+  for (int i = 0; i < kElementCount; ++i) {
+    stats.DMG_bonus[i] = seed + 20 + i + 0.5;
+    stats.RES[i] = seed + 30 + i + 0.5;
+  }
+
+  return stats;
+}
+
+/**
+ * @brief Check if AddStats() adds every field
+ *
+ * @return True if it does
+ */
+constexpr bool CheckAddStats() {
+  auto lhs = MakeCheckStats(100);
+  auto rhs = MakeCheckStats(1000);
+  auto result = lhs;
+  AddStats(&result, rhs);
+
+  for (int i = 0; i < kElementCount; ++i) {
+    if (result.DMG_bonus[i] != lhs.DMG_bonus[i] + rhs.DMG_bonus[i] ||
+        result.RES[i] != lhs.RES[i] + rhs.RES[i]) {
+      return false;
+    }
+  }
+
+  return result.max_HP_base == lhs.max_HP_base + rhs.max_HP_base &&
+         result.max_HP_ext == lhs.max_HP_ext + rhs.max_HP_ext &&
+         result.max_HP_percent == lhs.max_HP_percent + rhs.max_HP_percent &&
+         result.ATK_base == lhs.ATK_base + rhs.ATK_base &&
+         result.ATK_ext == lhs.ATK_ext + rhs.ATK_ext &&
+         result.ATK_percent == lhs.ATK_percent + rhs.ATK_percent &&
+         result.DEF_base == lhs.DEF_base + rhs.DEF_base &&
+         result.DEF_ext == lhs.DEF_ext + rhs.DEF_ext &&
+         result.DEF_percent == lhs.DEF_percent + rhs.DEF_percent &&
+         result.elemental_mastery ==
+             lhs.elemental_mastery + rhs.elemental_mastery &&
+         result.max_stamina == lhs.max_stamina + rhs.max_stamina &&
+         result.CRIT_rate == lhs.CRIT_rate + rhs.CRIT_rate &&
+         result.CRIT_DMG == lhs.CRIT_DMG + rhs.CRIT_DMG &&
+         result.healing_bonus == lhs.healing_bonus + rhs.healing_bonus &&
+         result.incoming_healing_bonus ==
+             lhs.incoming_healing_bonus + rhs.incoming_healing_bonus &&
+         result.energy_recharge == lhs.energy_recharge + rhs.energy_recharge &&
+         result.CD_reduction == lhs.CD_reduction + rhs.CD_reduction &&
+         result.shield_strength == lhs.shield_strength + rhs.shield_strength;
+}
+
+/**
+ * @brief Check if ScaleStats() scales every field and truncates the integer
+ * stats
+ *
+ * @return True if it does
+ */
+constexpr bool CheckScaleStats() {
+  auto origin = MakeCheckStats(100);
+  auto result = origin;
+  ScaleStats(&result, 0.75);
+
+  for (int i = 0; i < kElementCount; ++i) {
+    if (result.DMG_bonus[i] != origin.DMG_bonus[i] * 0.75 ||
+        result.RES[i] != origin.RES[i] * 0.75) {
+      return false;
+    }
+  }
+
+  return result.max_HP_base == static_cast<int>(origin.max_HP_base * 0.75) &&
+         result.max_HP_ext == static_cast<int>(origin.max_HP_ext * 0.75) &&
+         result.max_HP_percent == origin.max_HP_percent * 0.75 &&
+         result.ATK_base == static_cast<int>(origin.ATK_base * 0.75) &&
+         result.ATK_ext == static_cast<int>(origin.ATK_ext * 0.75) &&
+         result.ATK_percent == origin.ATK_percent * 0.75 &&
+         result.DEF_base == static_cast<int>(origin.DEF_base * 0.75) &&
+         result.DEF_ext == static_cast<int>(origin.DEF_ext * 0.75) &&
+         result.DEF_percent == origin.DEF_percent * 0.75 &&
+         result.elemental_mastery ==
+             static_cast<int>(origin.elemental_mastery * 0.75) &&
+         result.max_stamina == static_cast<int>(origin.max_stamina * 0.75) &&
+         result.CRIT_rate == origin.CRIT_rate * 0.75 &&
+         result.CRIT_DMG == origin.CRIT_DMG * 0.75 &&
+         result.healing_bonus == origin.healing_bonus * 0.75 &&
+         result.incoming_healing_bonus ==
+             origin.incoming_healing_bonus * 0.75 &&
+         result.energy_recharge == origin.energy_recharge * 0.75 &&
+         result.CD_reduction == origin.CD_reduction * 0.75 &&
+         result.shield_strength == origin.shield_strength * 0.75;
+}
+
+/**
+ * @brief Check if SubtractStats() subtracts every field
+ *
+ * @return True if it does
+ */
+constexpr bool CheckSubtractStats() {
+  auto lhs = MakeCheckStats(1000);
+  auto rhs = MakeCheckStats(100);
+  auto result = lhs;
+  SubtractStats(&result, rhs);
+
+  for (int i = 0; i < kElementCount; ++i) {
+    if (result.DMG_bonus[i] != lhs.DMG_bonus[i] - rhs.DMG_bonus[i] ||
+        result.RES[i] != lhs.RES[i] - rhs.RES[i]) {
+      return false;
+    }
+  }
+
+  return result.max_HP_base == lhs.max_HP_base - rhs.max_HP_base &&
+         result.max_HP_ext == lhs.max_HP_ext - rhs.max_HP_ext &&
+         result.max_HP_percent == lhs.max_HP_percent - rhs.max_HP_percent &&
+         result.ATK_base == lhs.ATK_base - rhs.ATK_base &&
+         result.ATK_ext == lhs.ATK_ext - rhs.ATK_ext &&
+         result.ATK_percent == lhs.ATK_percent - rhs.ATK_percent &&
+         result.DEF_base == lhs.DEF_base - rhs.DEF_base &&
+         result.DEF_ext == lhs.DEF_ext - rhs.DEF_ext &&
+         result.DEF_percent == lhs.DEF_percent - rhs.DEF_percent &&
+         result.elemental_mastery ==
+             lhs.elemental_mastery - rhs.elemental_mastery &&
+         result.max_stamina == lhs.max_stamina - rhs.max_stamina &&
+         result.CRIT_rate == lhs.CRIT_rate - rhs.CRIT_rate &&
+         result.CRIT_DMG == lhs.CRIT_DMG - rhs.CRIT_DMG &&
+         result.healing_bonus == lhs.healing_bonus - rhs.healing_bonus &&
+         result.incoming_healing_bonus ==
+             lhs.incoming_healing_bonus - rhs.incoming_healing_bonus &&
+         result.energy_recharge == lhs.energy_recharge - rhs.energy_recharge &&
+         result.CD_reduction == lhs.CD_reduction - rhs.CD_reduction &&
+         result.shield_strength == lhs.shield_strength - rhs.shield_strength;
+}
+
+static_assert(CheckAddStats(), "Stats addition must add every field");
+static_assert(CheckScaleStats(), "Stats scaling must scale every field");
+static_assert(CheckSubtractStats(),
+              "Stats subtraction must subtract every field");
+
+}  // namespace
+
 int Stats::GetATK() const {
   return static_cast<int>(this->ATK_base * (1 + this->ATK_percent) +
                           this->ATK_ext);
@@ -42,106 +315,52 @@ int Stats::GetDEF() const {
                           this->DEF_ext);
 }
 
+double Stats::GetDMGBonus(const world::ElementType& element) const {
+  return this->DMG_bonus[static_cast<int>(element)];
+}
+
 int Stats::GetMaxHP() const {
   return static_cast<int>(this->max_HP_base * (1 + this->max_HP_percent) +
                           this->max_HP_ext);
 }
 
-Stats Stats::operator+(const Stats& other) {
-  Stats stats;
-
-  stats.max_HP_base = this->max_HP_base + other.max_HP_base;
-  stats.max_HP_percent = this->max_HP_percent + other.max_HP_percent;
-  stats.max_HP_ext = this->max_HP_ext + other.max_HP_ext;
-  stats.ATK_base = this->ATK_base + other.ATK_base;
-  stats.ATK_percent = this->ATK_percent + other.ATK_percent;
-  stats.ATK_ext = this->ATK_ext = other.ATK_ext;
-  stats.DEF_base = this->DEF_base + other.DEF_base;
-  stats.DEF_percent = this->DEF_percent + other.DEF_percent;
-  stats.DEF_ext = this->DEF_ext + other.DEF_ext;
-  stats.max_stamina = this->max_stamina + other.max_stamina;
-
-  stats.CRIT_rate = this->CRIT_rate + other.CRIT_rate;
-  stats.CRIT_DMG = this->CRIT_DMG + other.CRIT_DMG;
-  stats.healing_bonus = this->healing_bonus + other.healing_bonus;
-  stats.incoming_healing_bonus =
-      this->incoming_healing_bonus + other.incoming_healing_bonus;
-  stats.energy_recharge = this->energy_recharge + other.energy_recharge;
-  stats.CD_reduction = this->CD_reduction + other.CD_reduction;
-  stats.shield_strength = this->shield_strength + other.shield_strength;
-
-  stats.pyro_DMG_bonus = this->pyro_DMG_bonus + other.pyro_DMG_bonus;
-  stats.pyro_RES = this->pyro_RES + other.pyro_RES;
-  stats.hydro_DMG_bonus = this->hydro_DMG_bonus + other.hydro_DMG_bonus;
-  stats.hydro_RES = this->hydro_RES + other.hydro_RES;
-  stats.dendro_DMG_bonus = this->dendro_DMG_bonus + other.dendro_DMG_bonus;
-  stats.dendro_RES = this->dendro_RES + other.dendro_RES;
-  stats.electro_DMG_bonus = this->electro_DMG_bonus + other.electro_DMG_bonus;
-  stats.electro_RES = this->electro_RES + other.electro_RES;
-  stats.anemo_DMG_bonus = this->anemo_DMG_bonus + other.anemo_DMG_bonus;
-  stats.anemo_RES = this->anemo_RES + other.anemo_RES;
-  stats.cryo_DMG_bonus = this->cryo_DMG_bonus + other.cryo_DMG_bonus;
-  stats.cryo_RES = this->cryo_RES + other.cryo_RES;
-  stats.geo_DMG_bonus = this->geo_DMG_bonus + other.geo_DMG_bonus;
-  stats.geo_RES = this->geo_RES + other.geo_RES;
-  stats.physical_DMG_bonus =
-      this->physical_DMG_bonus + other.physical_DMG_bonus;
-  stats.physical_RES = this->physical_RES + other.physical_RES;
+double Stats::GetRES(const world::ElementType& element) const {
+  return this->RES[static_cast<int>(element)];
+}
 
+Stats Stats::operator+(const Stats& other) const {
+  Stats stats = *this;
+  stats += other;
   return stats;
 }
 
-Stats Stats::operator+=(const Stats& other) {
-  *this = *this + other;
+Stats& Stats::operator+=(const Stats& other) {
+  AddStats(this, other);
+
   return *this;
 }
 
-Stats Stats::operator-(const Stats& other) {
-  Stats stats;
+Stats Stats::operator-(const Stats& other) const {
+  Stats stats = *this;
+  stats -= other;
+  return stats;
+}
 
-  stats.max_HP_base = this->max_HP_base - other.max_HP_base;
-  stats.max_HP_percent = this->max_HP_percent - other.max_HP_percent;
-  stats.max_HP_ext = this->max_HP_ext - other.max_HP_ext;
-  stats.ATK_base = this->ATK_base - other.ATK_base;
-  stats.ATK_percent = this->ATK_percent - other.ATK_percent;
-  stats.ATK_ext = this->ATK_ext = other.ATK_ext;
-  stats.DEF_base = this->DEF_base - other.DEF_base;
-  stats.DEF_percent = this->DEF_percent - other.DEF_percent;
-  stats.DEF_ext = this->DEF_ext - other.DEF_ext;
-  stats.max_stamina = this->max_stamina - other.max_stamina;
-
-  stats.CRIT_rate = this->CRIT_rate - other.CRIT_rate;
-  stats.CRIT_DMG = this->CRIT_DMG - other.CRIT_DMG;
-  stats.healing_bonus = this->healing_bonus - other.healing_bonus;
-  stats.incoming_healing_bonus =
-      this->incoming_healing_bonus - other.incoming_healing_bonus;
-  stats.energy_recharge = this->energy_recharge - other.energy_recharge;
-  stats.CD_reduction = this->CD_reduction - other.CD_reduction;
-  stats.shield_strength = this->shield_strength - other.shield_strength;
-
-  stats.pyro_DMG_bonus = this->pyro_DMG_bonus - other.pyro_DMG_bonus;
-  stats.pyro_RES = this->pyro_RES - other.pyro_RES;
-  stats.hydro_DMG_bonus = this->hydro_DMG_bonus - other.hydro_DMG_bonus;
-  stats.hydro_RES = this->hydro_RES - other.hydro_RES;
-  stats.dendro_DMG_bonus = this->dendro_DMG_bonus - other.dendro_DMG_bonus;
-  stats.dendro_RES = this->dendro_RES - other.dendro_RES;
-  stats.electro_DMG_bonus = this->electro_DMG_bonus - other.electro_DMG_bonus;
-  stats.electro_RES = this->electro_RES - other.electro_RES;
-  stats.anemo_DMG_bonus = this->anemo_DMG_bonus - other.anemo_DMG_bonus;
-  stats.anemo_RES = this->anemo_RES - other.anemo_RES;
-  stats.cryo_DMG_bonus = this->cryo_DMG_bonus - other.cryo_DMG_bonus;
-  stats.cryo_RES = this->cryo_RES - other.cryo_RES;
-  stats.geo_DMG_bonus = this->geo_DMG_bonus - other.geo_DMG_bonus;
-  stats.geo_RES = this->geo_RES - other.geo_RES;
-  stats.physical_DMG_bonus =
-      this->physical_DMG_bonus - other.physical_DMG_bonus;
-  stats.physical_RES = this->physical_RES - other.physical_RES;
+Stats& Stats::operator-=(const Stats& other) {
+  SubtractStats(this, other);
 
+  return *this;
+}
+
+Stats Stats::operator*(double factor) const {
+  Stats stats = *this;
+  stats *= factor;
   return stats;
 }
 
-Stats Stats::operator-=(const Stats& other) {
-  *this = *this - other;
+Stats& Stats::operator*=(double factor) {
+  ScaleStats(this, factor);
+
   return *this;
 }
 
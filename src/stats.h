@@ -31,6 +31,8 @@
 #ifndef GENSHICRAFT_STATS_H_
 #define GENSHICRAFT_STATS_H_
 
+#include "world.h"
+
 namespace genshicraft {
 
 class Stats {
@@ -49,6 +51,14 @@ class Stats {
    */
   int GetDEF() const;
 
+  /**
+   * @brief Get the DMG bonus of an element
+   *
+   * @param element The element type
+   * @return The DMG bonus
+   */
+  double GetDMGBonus(const world::ElementType& element) const;
+
   /**
    * @brief Get the max HP
    *
@@ -56,13 +66,33 @@ class Stats {
    */
   int GetMaxHP() const;
 
-  Stats operator+(const Stats& other);
+  /**
+   * @brief Get the RES of an element
+   *
+   * @param element The element type
+   * @return The RES
+   */
+  double GetRES(const world::ElementType& element) const;
 
-  Stats operator+=(const Stats& other);
+  Stats operator+(const Stats& other) const;
 
-  Stats operator-(const Stats& other);
+  Stats& operator+=(const Stats& other);
 
-  Stats operator-=(const Stats& other);
+  Stats operator-(const Stats& other) const;
+
+  Stats& operator-=(const Stats& other);
+
+  Stats operator*(double factor) const;
+
+  /**
+   * @brief Scale all stats by a factor
+   *
+   * @param factor The factor
+   * @return The scaled stats
+   *
+   * @note The integer stats are truncated after scaling.
+   */
+  Stats& operator*=(double factor);
 
   // Base stats
   int max_HP_base = 0;
@@ -86,23 +116,9 @@ class Stats {
   double CD_reduction = 0.;
   double shield_strength = 0.;
 
-  // Elemental type
-  double pyro_DMG_bonus = 0.;
-  double pyro_RES = 0.;
-  double hydro_DMG_bonus = 0.;
-  double hydro_RES = 0.;
-  double dendro_DMG_bonus = 0.;
-  double dendro_RES = 0.;
-  double electro_DMG_bonus = 0.;
-  double electro_RES = 0.;
-  double anemo_DMG_bonus = 0.;
-  double anemo_RES = 0.;
-  double cryo_DMG_bonus = 0.;
-  double cryo_RES = 0.;
-  double geo_DMG_bonus = 0.;
-  double geo_RES = 0.;
-  double physical_DMG_bonus = 0.;
-  double physical_RES = 0.;
+  // Elemental type, indexed by world::ElementType
+  double DMG_bonus[8] = {};
+  double RES[8] = {};
 };
 
 }  // namespace genshicraft
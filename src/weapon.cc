@@ -35,6 +35,7 @@
 
 #include <MC/CompoundTag.hpp>
 #include <MC/ItemStack.hpp>
+#include <MC/ListTag.hpp>
 #include <MC/Player.hpp>
 #include <algorithm>
 #include <memory>
@@ -43,10 +44,13 @@
 
 #include "character.h"
 #include "exceptions.h"
+#include "item.h"
+#include "level_table.h"
 #include "playerex.h"
 #include "plugin.h"
 #include "weapons/dull_blade.h"
 #include "weapons/silver_sword.h"
+#include "world.h"
 
 namespace genshicraft {
 
@@ -153,10 +157,13 @@ std::vector<std::string> Weapon::GetBaseStatsDescription() const {
     description.push_back(
         "Energy Recharge: " +
         std::to_string(this->GetBaseStats().energy_recharge * 100) + "%");
-  } else if (std::abs(this->GetBaseStats().physical_DMG_bonus) > 0.000001) {
-    description.push_back(
-        "Physical DMG Bonus: " +
-        std::to_string(this->GetBaseStats().physical_DMG_bonus * 100) + "%");
+  } else if (std::abs(this->GetBaseStats().GetDMGBonus(
+                 world::ElementType::kPhysical)) > 0.000001) {
+    description.push_back("Physical DMG Bonus: " +
+                          std::to_string(this->GetBaseStats().GetDMGBonus(
+                                             world::ElementType::kPhysical) *
+                                         100) +
+                          "%");
   }
 
   return description;
@@ -171,50 +178,8 @@ int Weapon::GetLevelByWeaponEXP(int weapon_exp) const {
 
   // Get the level by the weapon EXP
   int level = 1;
-  if (rarity == 1) {
-    for (int i = 1; i <= 70; ++i) {
-      if (Weapon::k1StarLevelMinWeaponEXPList[i] <= weapon_exp) {
-        level = i;
-      } else {
-        break;
-      }
-    }
-  }
-  if (rarity == 2) {
-    for (int i = 1; i <= 70; ++i) {
-      if (Weapon::k2StarLevelMinWeaponEXPList[i] <= weapon_exp) {
-        level = i;
-      } else {
-        break;
-      }
-    }
-  }
-  if (rarity == 3) {
-    for (int i = 1; i <= 90; ++i) {
-      if (Weapon::k3StarLevelMinWeaponEXPList[i] <= weapon_exp) {
-        level = i;
-      } else {
-        break;
-      }
-    }
-  }
-  if (rarity == 4) {
-    for (int i = 1; i <= 90; ++i) {
-      if (Weapon::k4StarLevelMinWeaponEXPList[i] <= weapon_exp) {
-        level = i;
-      } else {
-        break;
-      }
-    }
-  }
-  if (rarity == 5) {
-    for (int i = 1; i <= 90; ++i) {
-      if (Weapon::k5StarLevelMinWeaponEXPList[i] <= weapon_exp) {
-        level = i;
-      } else {
-        break;
-      }
-    }
+  if (rarity >= 1 && rarity <= 5) {
+    level = Weapon::kLevelTableList[rarity - 1].GetLevel(weapon_exp);
   }
 
   // Limit the level by the Ascension Phase
@@ -228,7 +193,19 @@ int Weapon::GetRefinement() const { return this->refinement_; }
 
 int Weapon::GetWeaponEXP() const { return this->weapon_exp_; }
 
+int Weapon::GetWeaponEXPByLevel(int level) const {
+  auto rarity = this->GetRarity();
+
+  if (rarity < 1 || rarity > 5) {
+    return 0;
+  }
+
+  return Weapon::kLevelTableList[rarity - 1].GetEXP(level);
+}
+
 void Weapon::IncreaseAscensionPhase() {
+  auto old_ascension_phase = this->ascension_phase_;
+
   if (this->GetLevel() ==
       Weapon::kAcensionPhaseMaxLevelList
           [this->ascension_phase_]) {  // if it is time to ascense
@@ -239,34 +216,52 @@ void Weapon::IncreaseAscensionPhase() {
       this->ascension_phase_ = std::min(this->ascension_phase_ + 1, 6);
     }
   }
+
+  if (this->ascension_phase_ != old_ascension_phase) {
+    this->WriteData();
+  }
 }
 
 void Weapon::IncreaseWeaponEXP(int value) {
-  this->weapon_exp_ += std::max(value, 0);
+  if (value <= 0) {
+    return;
+  }
+
+  this->weapon_exp_ += value;
+
+  this->WriteData();
 }
 
 bool Weapon::CheckIsWeapon(ItemStack* item) {
-  auto current_identifier = item->getTypeName();
+  return item::Classify(item).kind == item::Kind::kWeapon;
+}
 
-  for (const auto& identifier : Weapon::kIdentifierList) {
-    if (current_identifier == identifier) {
-      return true;
+int Weapon::GetWeaponID(const std::string& identifier) {
+  for (int i = 0; i < static_cast<int>(Weapon::kIdentifierList.size()); ++i) {
+    if (identifier == Weapon::kIdentifierList[i]) {
+      return i;
     }
   }
 
-  return false;
+  return -1;
 }
 
 std::shared_ptr<Weapon> Weapon::Make(ItemStack* item, PlayerEx* playerex) {
-  if (item->getTypeName() == "genshicraft:dull_blade") {
-    return std::make_shared<DullBlade>(item, playerex);
+  auto classification = item::Classify(item);
+  if (classification.kind != item::Kind::kWeapon) {
+    throw ExceptionNotAWeapon();
   }
 
-  if (item->getTypeName() == "genshicraft:silver_sword") {
-    return std::make_shared<SilverSword>(item, playerex);
-  }
+  switch (classification.id) {
+    case 0:  // genshicraft:dull_blade
+      return std::make_shared<DullBlade>(item, playerex);
 
-  throw ExceptionNotAWeapon();
+    case 1:  // genshicraft:silver_sword
+      return std::make_shared<SilverSword>(item, playerex);
+
+    default:
+      throw ExceptionNotAWeapon();
+  }
 }
 
 Weapon::Weapon(ItemStack* item, PlayerEx* playerex)
@@ -287,53 +282,88 @@ Weapon::Weapon(ItemStack* item, PlayerEx* playerex)
     this->refinement_ = 1;
 
     nbt->put("tag", CompoundTag());
-
-    auto tag = nbt->getCompound("tag");
-    tag->put("genshicraft", CompoundTag());
-
-    auto data = tag->getCompound("genshicraft");
-    data->putInt("ascension_phase",
-                 this->ascension_phase_);           // the Ascension Phase
-    data->putInt("refinement", this->refinement_);  // the Refinement
-    data->putInt("weapon_exp", this->weapon_exp_);  // the Weapon EXP
+    this->EncodeData(nbt->getCompound("tag"));
 
     item->setNbt(nbt.get());
     playerex->RefreshItems();
+
+  } else {
+    auto data = nbt->getCompound("tag")->getCompound("genshicraft");
+
+    this->DecodeData(data);
+
+    // Migrate the legacy layout on first touch
+    if (!data->contains("version")) {
+      this->EncodeData(nbt->getCompound("tag"));
+
+      item->setNbt(nbt.get());
+      playerex->RefreshItems();
+    }
   }
+}
 
-  auto data = nbt->getCompound("tag")->getCompound("genshicraft");
+Weapon::~Weapon() {
+  // Empty
+}
+
+void Weapon::DecodeData(CompoundTag* data) {
+  if (data->contains("version")) {
+    auto int_list = data->getList("int_list");
 
+    // Leave malformed data as a new weapon
+    if (int_list == nullptr || int_list->size() != 3) {
+      this->ascension_phase_ = 0;
+      this->refinement_ = 1;
+      this->weapon_exp_ = 0;
+      return;
+    }
+
+    // [Ascension Phase, Refinement, weapon EXP]
+    this->ascension_phase_ = int_list->getInt(0);
+    this->refinement_ = int_list->getInt(1);
+    this->weapon_exp_ = int_list->getInt(2);
+    return;
+  }
+
+  // The legacy layout
   this->ascension_phase_ = data->getInt("ascension_phase");
   this->refinement_ = data->getInt("refinement");
   this->weapon_exp_ = data->getInt("weapon_exp");
 }
 
-Weapon::~Weapon() {
-  auto nbt = this->item_->getNbt();
-  auto data = nbt->getCompound("tag")->getCompound("genshicraft");
+void Weapon::EncodeData(CompoundTag* tag) const {
+  auto data = CompoundTag::create();
 
-  bool is_modified = false;
-  if (this->ascension_phase_ != data->getInt("ascension_phase") ||
-      this->refinement_ != data->getInt("refinement") ||
-      this->weapon_exp_ != data->getInt("weapon_exp")) {
-    is_modified = true;
-  }
+  data->putInt("version", Weapon::kDataVersion);
 
-  data->putInt("ascension_phase",
-               this->ascension_phase_);           // the Ascension Phase
-  data->putInt("refinement", this->refinement_);  // the Refinement
-  data->putInt("weapon_exp", this->weapon_exp_);  // the Weapon EXP
+  // [Ascension Phase, Refinement, weapon EXP]
+  auto int_list = ListTag::create();
+  int_list->addInt(this->ascension_phase_);
+  int_list->addInt(this->refinement_);
+  int_list->addInt(this->weapon_exp_);
+  data->put("int_list", std::move(int_list));
 
-  if (is_modified) {
-    this->item_->setNbt(nbt.get());
-    this->playerex_->RefreshItems();
-  }
+  tag->put("genshicraft", std::move(data));
 }
 
+void Weapon::WriteData() {
+  auto nbt = this->item_->getNbt();
+  this->EncodeData(nbt->getCompound("tag"));
+
+  this->item_->setNbt(nbt.get());
+
+  this->ApplyLore(this->item_, this->playerex_);
+  this->playerex_->RefreshItems();
+}
+
+// The indices are the weapon IDs used by Weapon::Make()
 const std::vector<std::string> Weapon::kIdentifierList = {
     "genshicraft:dull_blade", "genshicraft:silver_sword"};
 
-const int Weapon::k1StarLevelMinWeaponEXPList[71] = {
+namespace {
+
+// The weapon EXP required by each level of 1-Star weapons
+constexpr int k1StarLevelMinWeaponEXPList[71] = {
     0,      0,      125,    325,    600,    950,    1425,   2000,   2700,
     3550,   4550,   5700,   7000,   8475,   10125,  11975,  14025,  16275,
     18725,  21400,  24325,  27475,  31050,  34875,  38975,  43375,  48075,
@@ -343,7 +373,8 @@ const int Weapon::k1StarLevelMinWeaponEXPList[71] = {
     341325, 359625, 378500, 397975, 418050, 438725, 460025, 481950, 505625,
     529975, 555000, 580700, 607100, 634225, 662050, 690600, 719875};
 
-const int Weapon::k2StarLevelMinWeaponEXPList[71] = {
+// The weapon EXP required by each level of 2-Star weapons
+constexpr int k2StarLevelMinWeaponEXPList[71] = {
     0,      0,      175,    450,    850,    1400,   2100,    2975,   4025,
     5275,   6750,   8450,   10400,  12625,  15100,  17875,   20925,  24300,
     28000,  32025,  36400,  41125,  46475,  52225,  58400,   65000,  72025,
@@ -353,7 +384,8 @@ const int Weapon::k2StarLevelMinWeaponEXPList[71] = {
     511875, 539325, 567650, 596875, 626975, 658000, 689950,  722825, 758325,
     794825, 832350, 870925, 910525, 951200, 992950, 1035775, 1079675};
 
-const int Weapon::k3StarLevelMinWeaponEXPList[91] = {
+// The weapon EXP required by each level of 3-Star weapons
+constexpr int k3StarLevelMinWeaponEXPList[91] = {
     0,       0,       275,     700,     1300,    2100,    3125,    4400,
     5950,    7800,    9975,    12475,   15350,   18600,   22250,   26300,
     30800,   35750,   41150,   47050,   53475,   60400,   68250,   76675,
@@ -367,7 +399,8 @@ const int Weapon::k3StarLevelMinWeaponEXPList[91] = {
     2353725, 2441225, 2544500, 2660575, 2791000, 2937500, 3102050, 3286825,
     3494225, 3727000, 3988200};
 
-const int Weapon::k4StarLevelMinWeaponEXPList[91] = {
+// The weapon EXP required by each level of 4-Star weapons
+constexpr int k4StarLevelMinWeaponEXPList[91] = {
     0,       0,       400,     1025,    1925,    3125,    4675,    6625,
     8975,    11775,   15075,   18875,   23225,   28150,   33675,   39825,
     46625,   54125,   62325,   71275,   81000,   91500,   103400,  116175,
@@ -381,7 +414,8 @@ const int Weapon::k4StarLevelMinWeaponEXPList[91] = {
     3566175, 3698750, 3855225, 4031100, 4228700, 4450675, 4699975, 4979925,
     5294175, 5646875, 6042650};
 
-const int Weapon::k5StarLevelMinWeaponEXPList[91] = {
+// The weapon EXP required by each level of 5-Star weapons
+constexpr int k5StarLevelMinWeaponEXPList[91] = {
     0,       0,       600,     1550,    2900,    4700,    7025,    9950,
     13475,   17675,   22625,   28325,   34850,   42250,   50550,   59775,
     69975,   81225,   93525,   106950,  121550,  137300,  155150,  174325,
@@ -395,4 +429,24 @@ const int Weapon::k5StarLevelMinWeaponEXPList[91] = {
     5349675, 5548550, 5783275, 6047100, 6343500, 6676475, 7050425, 7470350,
     7941725, 8470775, 9064450};
 
+static_assert(LevelTable(k1StarLevelMinWeaponEXPList, 1, 70).CheckLookups(),
+              "The 1-Star weapon level table is inconsistent");
+static_assert(LevelTable(k2StarLevelMinWeaponEXPList, 1, 70).CheckLookups(),
+              "The 2-Star weapon level table is inconsistent");
+static_assert(LevelTable(k3StarLevelMinWeaponEXPList, 1, 90).CheckLookups(),
+              "The 3-Star weapon level table is inconsistent");
+static_assert(LevelTable(k4StarLevelMinWeaponEXPList, 1, 90).CheckLookups(),
+              "The 4-Star weapon level table is inconsistent");
+static_assert(LevelTable(k5StarLevelMinWeaponEXPList, 1, 90).CheckLookups(),
+              "The 5-Star weapon level table is inconsistent");
+
+}  // namespace
+
+const LevelTable Weapon::kLevelTableList[5] = {
+    LevelTable(k1StarLevelMinWeaponEXPList, 1, 70),
+    LevelTable(k2StarLevelMinWeaponEXPList, 1, 70),
+    LevelTable(k3StarLevelMinWeaponEXPList, 1, 90),
+    LevelTable(k4StarLevelMinWeaponEXPList, 1, 90),
+    LevelTable(k5StarLevelMinWeaponEXPList, 1, 90)};
+
 }  // namespace genshicraft
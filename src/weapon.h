@@ -31,6 +31,7 @@
 #ifndef GENSHICRAFT_WEAPON_H_
 #define GENSHICRAFT_WEAPON_H_
 
+#include <MC/CompoundTag.hpp>
 #include <MC/ItemStack.hpp>
 #include <map>
 #include <memory>
@@ -38,6 +39,7 @@
 #include <vector>
 
 #include "character.h"
+#include "level_table.h"
 #include "stats.h"
 
 namespace genshicraft {
@@ -158,10 +160,19 @@ class Weapon {
    */
   int GetWeaponEXP() const;
 
+  /**
+   * @brief Get the minimum weapon EXP of a level
+   *
+   * @param level The level
+   * @return The minimum weapon EXP
+   */
+  int GetWeaponEXPByLevel(int level) const;
+
   /**
    * @brief Increase 1 ascension phase till 4 (for 1-Star and 2-Star weapons) or
    * 6 (for others). If not time to ascend, it will not take effect.
    *
+   * @note The change is written to the item immediately.
    */
   void IncreaseAscensionPhase();
 
@@ -176,6 +187,8 @@ class Weapon {
    * @brief Increase the weapon EXP
    *
    * @param value The value to increase. Negative value will not take effect.
+   *
+   * @note The change is written to the item immediately.
    */
   void IncreaseWeaponEXP(int value);
 
@@ -187,6 +200,15 @@ class Weapon {
    */
   static bool CheckIsWeapon(ItemStack *item);
 
+  /**
+   * @brief Get the weapon ID of an identifier
+   *
+   * @param identifier The identifier
+   * @return The index in Weapon::kIdentifierList, or -1 if the identifier is
+   * not of a GenshiCraft weapon
+   */
+  static int GetWeaponID(const std::string &identifier);
+
   /**
    * @brief Make a Weapon object
    *
@@ -216,24 +238,39 @@ class Weapon {
   virtual ~Weapon();
 
  private:
+  /**
+   * @brief Read the data from the "genshicraft" compound in either the packed
+   * or the legacy layout
+   *
+   * @param data The "genshicraft" compound
+   */
+  void DecodeData(CompoundTag *data);
+
+  /**
+   * @brief Write the data to a tag as the "genshicraft" compound in the
+   * packed layout
+   *
+   * @param tag The "tag" compound of the item NBT
+   *
+   * @note Any legacy layout data is replaced.
+   */
+  void EncodeData(CompoundTag *tag) const;
+
+  /**
+   * @brief Write the data to the NBT of the item and refresh the lore
+   *
+   */
+  void WriteData();
+
+  inline static const int kDataVersion =
+      1;  // the version of the packed NBT layout, and the legacy layout has
+          // no version
+
   const static std::vector<std::string>
       kIdentifierList;  // identifiers of all weapons
 
-  const static int
-      k1StarLevelMinWeaponEXPList[71];  // weapon EXP required by each
-                                        // level of 1-Star weapons
-  const static int
-      k2StarLevelMinWeaponEXPList[71];  // weapon EXP required by each
-                                        // level of 2-Star weapons
-  const static int
-      k3StarLevelMinWeaponEXPList[91];  // weapon EXP required by each
-                                        // level of 3-Star weapons
-  const static int
-      k4StarLevelMinWeaponEXPList[91];  // weapon EXP required by each
-                                        // level of 4-Star weapons
-  const static int
-      k5StarLevelMinWeaponEXPList[91];  // weapon EXP required by each
-                                        // level of 5-Star weapons
+  const static LevelTable
+      kLevelTableList[5];  // the level tables of 1-Star to 5-Star weapons
 
   int ascension_phase_;  // the Ascension Phase
   ItemStack *item_;      // the ItemStack object